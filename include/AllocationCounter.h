@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Contador global de alocações no heap, para medir alocações do laço de
+ * construção. É diagnóstico: só com LPQ_COUNT_ALLOCATIONS (make
+ * COUNT_ALLOCATIONS=1) o operator new global é substituído em
+ * AllocationCounter.cpp; nos demais builds as alocações não pagam os
+ * contadores atômicos e os valores são sempre 0.
+ */
+class AllocationCounter
+{
+public:
+    /**
+     * @brief true se o binário foi compilado com a contagem de alocações
+     */
+    static bool enabled();
+
+    /**
+     * @brief Número de chamadas a operator new desde o início do programa
+     */
+    static unsigned long long count();
+
+    /**
+     * @brief Total de bytes solicitados a operator new desde o início do programa
+     */
+    static unsigned long long bytes();
+};
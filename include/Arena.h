@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * Alocador por região (bump allocator) para buffers temporários.
+ *
+ * allocate apenas avança um ponteiro; reset libera tudo de uma vez. Se uma
+ * iteração precisou de mais de um bloco, reset os funde em um único bloco
+ * com a capacidade total, de modo que em regime permanente nenhuma
+ * alocação no heap é feita.
+ */
+class Arena
+{
+public:
+    explicit Arena(size_t initialBytes = 0);
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+    Arena(Arena &&other) noexcept;
+    Arena &operator=(Arena &&other) noexcept;
+
+    /**
+     * @brief Reserva bytes alinhados na região
+     */
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Libera todas as alocações (os ponteiros anteriores ficam inválidos)
+     */
+    void reset();
+
+    size_t capacity() const;
+    size_t used() const;
+
+    /**
+     * @brief Número de blocos pedidos ao heap desde a criação
+     */
+    size_t blockAllocations() const { return blocksAllocated; }
+
+private:
+    struct Block
+    {
+        char *data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t offset; // posição livre no último bloco
+    size_t usedBefore; // bytes usados nos blocos anteriores ao último
+    size_t blocksAllocated;
+
+    void addBlock(size_t minBytes);
+    void releaseAll();
+};
+
+/**
+ * Vetor de capacidade fixa alocado em uma Arena (tipos triviais apenas).
+ * A memória pertence à arena: não há liberação individual.
+ */
+template <typename T>
+class ArenaArray
+{
+public:
+    void allocate(Arena &arena, size_t capacity)
+    {
+        items = static_cast<T *>(arena.allocate(capacity * sizeof(T), alignof(T)));
+        count = 0;
+        cap = capacity;
+    }
+
+    void clear() { count = 0; }
+    void push_back(const T &value) { new (items + count++) T(value); }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return cap; }
+    bool empty() const { return count == 0; }
+    T &operator[](size_t i) { return items[i]; }
+    const T &operator[](size_t i) const { return items[i]; }
+    T *begin() { return items; }
+    T *end() { return items + count; }
+    const T *begin() const { return items; }
+    const T *end() const { return items + count; }
+
+private:
+    T *items = nullptr;
+    size_t count = 0;
+    size_t cap = 0;
+};
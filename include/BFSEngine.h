@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Graph.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Motor de busca em largura reutilizável.
+ *
+ * Mantém os vetores de visitação entre chamadas: a marcação usa um contador
+ * de época, então iniciar uma nova busca custa O(1) em vez de O(n). Também
+ * oferece um modo bit-paralelo que executa 64 buscas de uma vez, uma por bit
+ * de uma palavra de 64 bits por vértice.
+ */
+class BFSEngine
+{
+public:
+    /**
+     * @brief Estatísticas de excentricidade (por componente conexa)
+     */
+    struct DistanceStats
+    {
+        int diameter;               // maior excentricidade
+        int radius;                 // menor excentricidade
+        double averageEccentricity; // média das excentricidades
+        int components;             // número de componentes conexas
+    };
+
+    explicit BFSEngine(const Graph &g);
+
+    /**
+     * @brief Associa o motor a outro grafo (ou ao mesmo após mudar de tamanho)
+     */
+    void attach(const Graph &g);
+
+    /**
+     * @brief Distância entre u e v
+     * @return Distância (ou -1 se não conectados)
+     */
+    int distance(int u, int v);
+
+    /**
+     * @brief BFS a partir de várias fontes simultaneamente
+     * @param sources Vértices de distância 0
+     * @param maxDepth Profundidade máxima (-1 = sem limite)
+     * @return Vértices alcançados em ordem não decrescente de distância
+     */
+    const std::vector<int> &run(const std::vector<int> &sources, int maxDepth = -1);
+
+    /**
+     * @brief Distância de v na última execução de run (-1 se não alcançado)
+     */
+    int distanceOf(int v) const { return stamp[v] == epoch ? dist[v] : -1; }
+
+    /**
+     * @brief Camadas de distância 0..k a partir de source
+     * @return layers[d] = vértices a distância exatamente d
+     */
+    std::vector<std::vector<int>> layers(int source, int k);
+
+    /**
+     * @brief Excentricidade de cada fonte (bit-paralelo, lotes de 64 fontes)
+     * @return Maior distância finita de cada fonte
+     */
+    std::vector<int> eccentricities(const std::vector<int> &sources);
+
+    /**
+     * @brief Diâmetro, raio e excentricidade média considerando todos os vértices
+     */
+    DistanceStats distanceStats();
+
+private:
+    const Graph *graph;
+    int numVertices;
+
+    // Busca simples
+    std::vector<uint32_t> stamp;
+    uint32_t epoch;
+    std::vector<int> dist;
+    std::vector<int> queue;
+
+    // Busca bit-paralela
+    std::vector<uint64_t> visited;
+    std::vector<uint64_t> frontier;
+    std::vector<uint64_t> next;
+
+    void nextEpoch();
+    void eccentricityBatch(const int *sources, int count, int *out);
+};
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Solver.h"
+#include "WorkStealingScheduler.h"
+#include <string>
+#include <vector>
+
+/**
+ * Execução em lote (subcomando "batch") como um pipeline de quatro estágios
+ * ligados por filas limitadas:
+ *
+ *   leitura + índice de distância 2 -> resolução -> validação -> gravação
+ *
+ * Cada estágio tem sua thread, então a instância N+1 é lida e indexada
+ * enquanto a N é resolvida, e os arquivos da N-1 são gravados em paralelo.
+ * A capacidade das filas limita quantos grafos ficam em memória ao mesmo
+ * tempo. Com jobs > 1, o estágio de resolução despacha as instâncias para um
+ * escalonador com roubo de trabalho, e instâncias lentas não seguram as
+ * demais. Cada instância usa uma semente própria derivada da semente do lote,
+ * então o resultado não depende da sobreposição entre os estágios.
+ */
+class BatchPipeline
+{
+public:
+    struct Settings
+    {
+        SolverOptions options;  // algoritmo e parâmetros comuns às instâncias
+        unsigned int seed = 1;  // semente do lote
+        std::string outputDir;  // vazio = não grava soluções
+        bool writeVisualization = false;
+        size_t queueCapacity = 1;
+        int jobs = 1;           // instâncias resolvidas ao mesmo tempo
+    };
+
+    /**
+     * @brief Resultado e tempos de cada estágio para uma instância
+     */
+    struct InstanceStats
+    {
+        std::string instance;
+        bool loaded = false;
+        bool solved = false;
+        bool valid = false;
+        int vertices = 0;
+        int maxColor = 0;
+        int lowerBound = 0;
+        unsigned int seed = 0;
+        double loadSeconds = 0.0;
+        double solveSeconds = 0.0;
+        double validateSeconds = 0.0;
+        double writeSeconds = 0.0;
+    };
+
+    enum Stage
+    {
+        LOAD,
+        SOLVE,
+        VALIDATE,
+        WRITE,
+        NUM_STAGES
+    };
+
+    BatchPipeline(std::vector<std::string> instances, Settings settings);
+
+    /**
+     * @brief Processa todas as instâncias
+     * @return true se todas foram lidas, resolvidas e validadas
+     */
+    bool run();
+
+    const std::vector<InstanceStats> &getStats() const { return stats; }
+    double getWallSeconds() const { return wallSeconds; }
+
+    /**
+     * @brief Tempo em que o estágio esteve trabalhando (sem esperar filas)
+     */
+    double getBusySeconds(Stage stage) const { return busySeconds[stage]; }
+
+    /**
+     * @brief Tarefas, roubos e ocupação dos workers de resolução (vazio com jobs = 1)
+     */
+    const std::vector<WorkStealingScheduler::WorkerStats> &getSchedulerStats() const { return schedulerStats; }
+
+    /**
+     * @brief Lê a lista de instâncias (um caminho por linha; '#' inicia comentário)
+     */
+    static bool readList(const std::string &filename, std::vector<std::string> &instances);
+
+    /**
+     * @brief Subcomando "batch" da linha de comando
+     * @return Código de saída do processo
+     */
+    static int runCommand(int argc, char *argv[]);
+
+private:
+    std::vector<std::string> instances;
+    Settings settings;
+    std::vector<InstanceStats> stats;
+    double wallSeconds;
+    double busySeconds[NUM_STAGES];
+    std::vector<WorkStealingScheduler::WorkerStats> schedulerStats;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Graph.h"
+#include "SharedIncumbent.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Branch-and-bound exato (estilo DSATUR) para L(p,q)-coloring.
+ *
+ * Parte de uma coloração viável de maior cor UB e procura colorações com
+ * maior cor < UB. Cada vértice mantém, por cor, quantos vizinhos já
+ * coloridos a proíbem (|c - c(u)| < p em N1, < q em N2) e um bitset das
+ * cores livres. Em cada nó o vértice ramificado é o de menor número de cores
+ * livres (o mais saturado) e as cores são tentadas em ordem crescente; um nó
+ * é podado se algum vértice fica sem cor livre ou se o limite inferior já
+ * alcança UB.
+ *
+ * Simetria: os vértices da maior clique de G² encontrada são ramificados
+ * primeiro, e a reflexão c -> T + 1 - c (que preserva todas as distâncias
+ * entre cores) permite restringir o primeiro deles à metade inferior das
+ * cores.
+ *
+ * Indicado para instâncias pequenas (até ~150 vértices); limites de nós e de
+ * tempo interrompem a busca com a melhor solução encontrada.
+ */
+class BranchAndBoundAlgorithm
+{
+public:
+    BranchAndBoundAlgorithm(const Graph &g, int p, int q);
+
+    /**
+     * @brief Busca a partir de uma coloração viável (limite superior inicial)
+     * @return Melhor coloração encontrada (ótima se isProven())
+     */
+    std::vector<int> solve(const std::vector<int> &initial);
+
+    /**
+     * @brief Limite inferior da maior cor; a busca para ao atingi-lo
+     */
+    void setLowerBound(int bound) { lowerBound = bound; }
+
+    /**
+     * @brief Máximo de nós explorados (0 = sem limite)
+     */
+    void setNodeLimit(long long limit) { nodeLimit = limit; }
+
+    /**
+     * @brief Tempo máximo em segundos (0 = sem limite)
+     */
+    void setTimeLimit(double seconds) { timeLimit = seconds; }
+
+    /**
+     * @brief Incumbente compartilhado: publica cada melhora e para quando ele sinaliza
+     */
+    void setIncumbent(SharedIncumbent *shared) { incumbent = shared; }
+
+    long long getNodes() const { return nodes; }
+    double getSeconds() const { return seconds; }
+
+    /**
+     * @brief true se a busca terminou sem limites: a solução é ótima
+     */
+    bool isProven() const { return proven; }
+
+    /**
+     * @brief Melhor limite inferior provado para a maior cor
+     */
+    int getBestBound() const { return bestBound; }
+
+private:
+    const Graph &graph;
+    int p_param;
+    int q_param;
+    int lowerBound;
+    long long nodeLimit;
+    double timeLimit;
+    SharedIncumbent *incumbent;
+
+    int n;
+    int colorCap; // maior cor representada nos domínios (UB inicial - 1)
+    int words;    // palavras de 64 bits por domínio
+    std::vector<std::vector<int>> n1, n2;
+    std::vector<int> squareDegree;
+    std::vector<int> clique; // ramificados primeiro, nesta ordem
+
+    std::vector<uint32_t> blocked; // blocked[v * (colorCap + 1) + c]: vizinhos que proíbem c
+    std::vector<uint64_t> freeBits; // bit c de v: cor c livre
+    std::vector<int> coloring;      // 0 = não colorido
+    std::vector<int> best;
+    int bestMax;
+
+    long long nodes;
+    double seconds;
+    bool proven;
+    bool aborted;
+    int bestBound;
+    std::chrono::steady_clock::time_point start;
+
+    void place(int v, int c, int sign);
+    int countFree(int v, int limit) const;
+    bool limitReached();
+    void search(int depth, int currentMax);
+};
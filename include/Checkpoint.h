@@ -0,0 +1,119 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class Graph;
+
+/**
+ * Estado do GRASP reativo em uma fronteira de bloco, suficiente para
+ * continuar a execução com resultado idêntico ao de uma execução contínua.
+ */
+struct ReactiveCheckpoint
+{
+    // Identificação da execução (validada ao retomar)
+    int numVertices = 0;
+    uint64_t numEdges = 0;
+    uint64_t graphHash = 0; // FNV-1a das listas de adjacência ordenadas
+    int p = 0;
+    int q = 0;
+    int blockSize = 0;
+    bool parallel = false;
+    int eliteSize = 0;
+    int rclSampleSize = 0;
+    uint64_t initialHash = 0; // solução inicial (--init ou guloso de --order)
+    std::vector<double> alphaValues;
+
+    // Estado do gerador: a versão serial guarda a semente do seu gerador
+    // próprio e o número de sorteios feitos; a paralela, a semente base das
+    // iterações
+    unsigned int seed = 0;
+    uint64_t rngDraws = 0;
+    unsigned int baseSeed = 0;
+
+    int nextIteration = 0;
+    int iterationsExecuted = 0;
+    int bestMaxColor = 0;
+    int bestIteration = 0;
+    int relinkImprovements = 0;
+    double sumSolutions = 0.0;
+    double bestAlphaUsed = 0.0;
+
+    std::vector<double> alphaProbabilities;
+    std::vector<double> alphaRewardSum;
+    std::vector<int> alphaUsageCount;
+    std::vector<int> bestColoring;
+    std::vector<std::pair<int, std::vector<int>>> elite; // (maior cor, coloração)
+
+    /**
+     * @brief Preenche numVertices, numEdges e graphHash a partir do grafo
+     */
+    void describeGraph(const Graph &graph);
+
+    /**
+     * @brief true se o checkpoint foi gravado para um grafo com a mesma impressão digital
+     */
+    bool matchesGraph(const Graph &graph) const;
+
+    /**
+     * @brief Impressão digital de uma coloração (FNV-1a; a vazia também tem uma)
+     */
+    static uint64_t hashColoring(const std::vector<int> &coloring);
+
+    /**
+     * @brief Serializa em formato binário compacto
+     */
+    std::vector<char> serialize() const;
+
+    /**
+     * @brief Lê um checkpoint do arquivo
+     * @return true se o arquivo existe e é válido
+     */
+    bool load(const std::string &filename);
+};
+
+/**
+ * Gravação de checkpoints em uma thread de fundo.
+ *
+ * submit() apenas entrega os bytes e retorna; a thread grava em um arquivo
+ * temporário e o renomeia sobre o destino (atômico), de modo que o arquivo
+ * de checkpoint é sempre o antigo ou o novo, nunca um parcial. Se um novo
+ * checkpoint chega antes da gravação do anterior, só o mais recente é gravado.
+ */
+class CheckpointWriter
+{
+public:
+    explicit CheckpointWriter(const std::string &filename);
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter &) = delete;
+    CheckpointWriter &operator=(const CheckpointWriter &) = delete;
+
+    void submit(std::vector<char> bytes);
+
+    /**
+     * @brief Aguarda a gravação pendente
+     */
+    void flush();
+
+    int getWritesCompleted() const;
+
+private:
+    std::string filename;
+    std::vector<char> pending;
+    bool hasPending;
+    bool writing;
+    bool stopping;
+    int writesCompleted;
+    mutable std::mutex mutex;
+    std::condition_variable cv;
+    std::thread worker;
+
+    void run();
+    bool writeAtomically(const std::vector<char> &bytes) const;
+};
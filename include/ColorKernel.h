@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Kernels vetoriais para testar uma cor candidata contra uma fatia contígua
+ * de cores (vizinhos em N1 ou N2 já reunidos em um buffer).
+ *
+ * A implementação (AVX2, SSE2 ou escalar) é escolhida em tempo de execução
+ * pela detecção de recursos da CPU e pode ser forçada com select().
+ * Cor 0 na fatia significa "não colorido" e é ignorada.
+ */
+class ColorKernel
+{
+public:
+    enum class Isa
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    /**
+     * @brief Melhor implementação suportada pela CPU
+     */
+    static Isa detect();
+
+    /**
+     * @brief Força uma implementação (cai para a melhor suportada se a pedida não for)
+     * @return Implementação efetivamente ativa
+     */
+    static Isa select(Isa isa);
+
+    static Isa active();
+    static const char *name(Isa isa);
+
+    /**
+     * @brief Converte "scalar", "sse2", "avx2" ou "auto"
+     * @return false se o nome for desconhecido
+     */
+    static bool parse(const std::string &text, Isa &isa);
+
+    /**
+     * @brief Maior (c + separation) dentre as cores c da fatia que violam
+     *        |color - c| >= separation; 0 se nenhuma viola
+     *
+     * Todas as cores em [color, retorno) violam a restrição com alguma cor da
+     * fatia, então o retorno é a próxima cor candidata.
+     */
+    static int violationJump(const int *colors, size_t count, int color, int separation);
+
+    /**
+     * @brief Menor cor >= start que respeita p na fatia N1 e q na fatia N2
+     */
+    static int smallestClearing(const int *n1Colors, size_t n1Count, int p,
+                                const int *n2Colors, size_t n2Count, int q,
+                                int start = 1);
+
+    // Implementações individuais (expostas para comparação com a escalar)
+    static int violationJumpScalar(const int *colors, size_t count, int color, int separation);
+    static int violationJumpSSE2(const int *colors, size_t count, int color, int separation);
+    static int violationJumpAVX2(const int *colors, size_t count, int color, int separation);
+};
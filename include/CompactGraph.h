@@ -0,0 +1,156 @@
+#pragma once
+
+#include "Graph.h"
+#include "ColorKernel.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Cópia das vizinhanças N1 e N2 em formato CSR (deslocamentos + ids
+ * contíguos), com ids de vértice de largura Index. Com n <= 65536 os ids
+ * cabem em 16 bits e as listas ocupam metade da banda de memória das
+ * listas de int do Graph.
+ */
+template <typename Index>
+class CompactNeighborhoods
+{
+public:
+    /**
+     * @param g Grafo com o índice de distância 2 já construído
+     */
+    explicit CompactNeighborhoods(const Graph &g)
+    {
+        const int n = g.getNumVertices();
+        start1.resize(n + 1);
+        start2.resize(n + 1);
+        start1[0] = start2[0] = 0;
+        for (int v = 0; v < n; ++v)
+        {
+            start1[v + 1] = start1[v] + g.getNeighbors(v).size();
+            start2[v + 1] = start2[v] + g.getDistance2Neighbors(v).size();
+        }
+        ids1.reserve(start1[n]);
+        ids2.reserve(start2[n]);
+        for (int v = 0; v < n; ++v)
+        {
+            for (int u : g.getNeighbors(v))
+                ids1.push_back(static_cast<Index>(u));
+            for (int u : g.getDistance2Neighbors(v))
+                ids2.push_back(static_cast<Index>(u));
+        }
+    }
+
+    int getNumVertices() const { return static_cast<int>(start1.size()) - 1; }
+
+    const Index *n1Begin(int v) const { return ids1.data() + start1[v]; }
+    const Index *n1End(int v) const { return ids1.data() + start1[v + 1]; }
+    const Index *n2Begin(int v) const { return ids2.data() + start2[v]; }
+    const Index *n2End(int v) const { return ids2.data() + start2[v + 1]; }
+
+    size_t getNumEntries() const { return ids1.size() + ids2.size(); }
+
+    size_t bytes() const
+    {
+        return (start1.size() + start2.size()) * sizeof(size_t) + getNumEntries() * sizeof(Index);
+    }
+
+private:
+    std::vector<size_t> start1, start2;
+    std::vector<Index> ids1, ids2;
+};
+
+/**
+ * Construção gulosa (mesma ordem e mesma regra de menor cor válida do
+ * GreedyAlgorithm) sobre as vizinhanças compactas, com cores de largura
+ * Color. Produz exatamente a mesma coloração que o caminho com int.
+ */
+template <typename Index, typename Color>
+class CompactGreedy
+{
+public:
+    CompactGreedy(const CompactNeighborhoods<Index> &nb, int p, int q)
+        : neighborhoods(nb), p_param(p), q_param(q)
+    {
+    }
+
+    std::vector<int> solve(const std::vector<int> &order)
+    {
+        colors.assign(neighborhoods.getNumVertices(), 0);
+        for (int v : order)
+            colors[v] = static_cast<Color>(smallestValidColor(v));
+        return std::vector<int>(colors.begin(), colors.end());
+    }
+
+    size_t workingBytes() const
+    {
+        return colors.capacity() * sizeof(Color) + (gather1.capacity() + gather2.capacity()) * sizeof(int);
+    }
+
+private:
+    const CompactNeighborhoods<Index> &neighborhoods;
+    int p_param;
+    int q_param;
+    std::vector<Color> colors; // 0 = não colorido
+
+    // Cores de N1 e N2 reunidas para o kernel vetorial (como no ConstructionState)
+    std::vector<int> gather1, gather2;
+
+    int smallestValidColor(int v)
+    {
+        const Index *b1 = neighborhoods.n1Begin(v), *e1 = neighborhoods.n1End(v);
+        const Index *b2 = neighborhoods.n2Begin(v), *e2 = neighborhoods.n2End(v);
+        const size_t c1 = static_cast<size_t>(e1 - b1), c2 = static_cast<size_t>(e2 - b2);
+        if (gather1.size() < c1)
+            gather1.resize(c1);
+        if (gather2.size() < c2)
+            gather2.resize(c2);
+        for (size_t i = 0; i < c1; ++i)
+            gather1[i] = colors[b1[i]];
+        for (size_t i = 0; i < c2; ++i)
+            gather2[i] = colors[b2[i]];
+        return ColorKernel::smallestClearing(gather1.data(), c1, p_param, gather2.data(), c2, q_param);
+    }
+};
+
+/**
+ * Escolha das larguras de id e de cor e despacho para as instâncias dos
+ * templates acima.
+ */
+class CompactGraph
+{
+public:
+    /**
+     * @brief Converte "auto" (0), "16", "32" ou "int" (-1, listas do Graph)
+     * @return false se o texto é inválido
+     */
+    static bool parseWidth(const std::string &text, int &bits);
+
+    /**
+     * @brief Limite superior da maior cor do guloso de menor cor válida
+     *
+     * Cada vizinho colorido proíbe no máximo 2p-1 cores (2q-1 em N2), então a
+     * cor escolhida nunca passa de 1 + max_v [(2p-1)|N1(v)| + (2q-1)|N2(v)|].
+     */
+    static long long colorBound(const Graph &g, int p, int q);
+
+    /**
+     * @brief Larguras para o pedido (0 = menores que cabem; 16 ou 32 = forçadas)
+     * @return false se a largura forçada não comporta n ou o limite de cores
+     */
+    static bool chooseWidths(const Graph &g, int p, int q, int requested, int &indexBits, int &colorBits);
+
+    /**
+     * @brief Guloso sobre as vizinhanças compactas nas larguras dadas, na ordem dada
+     */
+    static std::vector<int> greedy(const Graph &g, int p, int q, int indexBits, int colorBits,
+                                   const std::vector<int> &order);
+
+    /**
+     * @brief Memória e vazão do guloso para cada largura que comporta a instância
+     */
+    static void report(const Graph &g, int p, int q, std::ostream &out);
+};
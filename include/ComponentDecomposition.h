@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Graph.h"
+#include "Solver.h"
+#include "WorkStealingScheduler.h"
+#include <vector>
+
+/**
+ * Decomposição do grafo em componentes conexas.
+ *
+ * Vértices de componentes diferentes não têm restrições entre si, então
+ * cada componente é colorida de forma independente, com seu próprio
+ * subgrafo, índice de distância 2 e orçamento de iterações. A maior cor
+ * final é o máximo entre as componentes.
+ */
+class ComponentDecomposition
+{
+public:
+    /**
+     * @brief Resultado da resolução de uma componente
+     */
+    struct ComponentStats
+    {
+        int component; // índice em getComponent
+        int size;
+        int maxColor;
+        double seconds;
+    };
+
+    explicit ComponentDecomposition(const Graph &g);
+
+    int getNumComponents() const { return static_cast<int>(components.size()); }
+    int getLargestSize() const { return components.empty() ? 0 : static_cast<int>(components.front().size()); }
+    int getNumIsolated() const;
+
+    /**
+     * @brief Vértices da componente c em ordem crescente (componentes em ordem de tamanho decrescente)
+     */
+    const std::vector<int> &getComponent(int c) const { return components[c]; }
+
+    /**
+     * @brief Subgrafo induzido pela componente c, com índice de distância 2
+     *
+     * O vértice local i corresponde a getComponent(c)[i].
+     */
+    Graph buildSubgraph(int c) const;
+
+    /**
+     * @brief Resolve cada componente com options e junta as colorações
+     *
+     * As componentes são tarefas de um escalonador com roubo de trabalho de
+     * numWorkers threads, maiores primeiro. Cada uma usa um gerador próprio com semente derivada de
+     * options.randomSeed (ou de um sorteio de std::rand), de modo que o
+     * resultado não depende do número de threads. Vértices isolados recebem
+     * a cor 1 sem chamar o solver.
+     *
+     * @param stats Se não nulo, recebe as estatísticas das componentes resolvidas
+     * @param workerStats Se não nulo, recebe tarefas, roubos e ocupação por thread
+     */
+    SolverResult solve(const SolverOptions &options, int numWorkers,
+                       std::vector<ComponentStats> *stats = nullptr,
+                       std::vector<WorkStealingScheduler::WorkerStats> *workerStats = nullptr) const;
+
+private:
+    const Graph &graph;
+    std::vector<std::vector<int>> components;
+    std::vector<int> localIndex; // posição de cada vértice em sua componente
+};
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Graph.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * Índice de distância 2 comprimido: cada lista N2(v), ordenada, é gravada
+ * como o número de elementos seguido das diferenças entre elementos
+ * consecutivos (o primeiro em relação a 0), todos em varint (7 bits por
+ * byte, bit alto = continua). Em grafos com localidade as diferenças cabem
+ * quase sempre em um byte, contra 4 bytes por entrada nas listas de int.
+ *
+ * As listas não são descomprimidas para a memória: forEach e gather
+ * decodificam durante a iteração, e gather já reúne as cores dos vizinhos
+ * no buffer contíguo que o kernel de menor cor válida consome.
+ */
+class CompressedDistance2
+{
+public:
+    /**
+     * @param g Grafo com o índice de distância 2 construído
+     */
+    explicit CompressedDistance2(const Graph &g);
+
+    int getNumVertices() const { return static_cast<int>(offsets.size()) - 1; }
+
+    /**
+     * @brief Número de vértices a distância 2 de v
+     */
+    size_t count(int v) const
+    {
+        const uint8_t *in = bytes.data() + offsets[v];
+        return static_cast<size_t>(readVarint(in));
+    }
+
+    /**
+     * @brief Chama f(u) para cada u em N2(v), em ordem crescente
+     */
+    template <typename F>
+    void forEach(int v, F f) const
+    {
+        const uint8_t *in = bytes.data() + offsets[v];
+        uint32_t remaining = readVarint(in);
+        uint32_t value = 0;
+        while (remaining-- > 0)
+        {
+            value += readVarint(in);
+            f(static_cast<int>(value));
+        }
+    }
+
+    /**
+     * @brief out[i] = values[u_i] para os u_i de N2(v), em ordem
+     * @param out Buffer com pelo menos count(v) posições
+     * @return count(v)
+     */
+    size_t gather(int v, const int *values, int *out) const
+    {
+        const uint8_t *in = bytes.data() + offsets[v];
+        uint32_t total = readVarint(in);
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < total; ++i)
+        {
+            value += readVarint(in);
+            out[i] = values[value];
+        }
+        return total;
+    }
+
+    /**
+     * @brief Total de entradas (soma de |N2(v)|)
+     */
+    size_t getNumEntries() const { return numEntries; }
+
+    /**
+     * @brief Memória ocupada (bytes codificados + deslocamentos)
+     */
+    size_t memoryBytes() const;
+
+    /**
+     * @brief Memória das listas de int do Graph para o mesmo índice
+     */
+    static size_t rawMemoryBytes(const Graph &g);
+
+    /**
+     * @brief Compara memória por aresta de G² e vazão de iteração das listas
+     * de int e da versão comprimida
+     */
+    static void report(const Graph &g, const CompressedDistance2 &compressed, std::ostream &out);
+
+private:
+    std::vector<uint8_t> bytes;
+    std::vector<size_t> offsets; // início da lista de cada vértice em bytes
+    size_t numEntries;
+
+    static void writeVarint(std::vector<uint8_t> &out, uint32_t value);
+
+    static uint32_t readVarint(const uint8_t *&in)
+    {
+        uint32_t byte = *in++;
+        if (byte < 0x80)
+            return byte;
+        uint32_t value = byte & 0x7F;
+        int shift = 7;
+        do
+        {
+            byte = *in++;
+            value |= (byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        return value;
+    }
+};
@@ -31,12 +31,50 @@ namespace Config
     const std::string ALGORITHM_GREEDY = "greedy";
     const std::string ALGORITHM_GRASP = "grasp";
     const std::string ALGORITHM_REACTIVE = "reactive";
+    const std::string ALGORITHM_TABU = "tabu";
+    const std::string ALGORITHM_PORTFOLIO = "portfolio";
+    const std::string ALGORITHM_EXACT = "exact";
+    const std::string ALGORITHM_DSATUR = "dsatur";
+
+    // Ordens de vértices do guloso (--order)
+    const std::string ORDER_DEGREE = "degree";
+    const std::string ORDER_SMALLEST_LAST = "sl";
+    const std::string ORDER_RANDOM = "random";
+    const std::string ORDER_BFS = "bfs";
 
     // Parâmetros padrão para GRASP reativo
     constexpr int DEFAULT_BLOCK_SIZE_GRASPR = 30;
     constexpr int DEFAULT_REACTIVE_ITERATIONS = 300;
     const std::vector<double> DEFAULT_REACTIVE_ALPHAS = {0.1, 0.3, 0.5};
 
+    // Conjunto elite e religamento de caminhos (tamanho 0 = desativado)
+    constexpr int DEFAULT_ELITE_SIZE = 0;
+    constexpr double ELITE_MIN_DISTANCE_FRACTION = 0.05; // fração de n
+
+    // Paralelismo (1 = serial; 0 = todos os núcleos disponíveis)
+    constexpr int DEFAULT_THREADS = 1;
+
+    // RCL amostrada (0 = avalia todos os vértices não coloridos)
+    constexpr double DEFAULT_RCL_SAMPLE = 0.0;
+
+    // Intervalo mínimo entre checkpoints do GRASP reativo (segundos)
+    constexpr double DEFAULT_CHECKPOINT_INTERVAL = 60.0;
+
+    // Portfólio: configurações que disputam a instância e tempo máximo (0 = sem limite)
+    const std::string DEFAULT_PORTFOLIO = "greedy,tabu,grasp:0.1,grasp:0.3,grasp:0.5,reactive";
+    constexpr double DEFAULT_TIME_LIMIT = 0.0;
+
+    // Branch-and-bound exato: máximo de nós explorados (0 = sem limite)
+    constexpr long long DEFAULT_EXACT_NODE_LIMIT = 50000000LL;
+
+    // Servidor (subcomando serve): grafos mantidos no cache LRU
+    constexpr int DEFAULT_CACHE_GRAPHS = 4;
+
+    // Parâmetros padrão para busca tabu
+    constexpr int DEFAULT_TABU_ITERATIONS = 10000; // iterações sem melhora por span
+    constexpr int TABU_TENURE_RANDOM = 10;         // parcela aleatória da duração tabu
+    constexpr double TABU_TENURE_FACTOR = 0.6;     // fator sobre o número de vértices em conflito
+
 }
 
 #endif
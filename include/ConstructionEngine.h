@@ -0,0 +1,614 @@
+#pragma once
+
+#include "Graph.h"
+#include "Arena.h"
+#include "Distance2Cache.h"
+#include "VertexOrdering.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ * Motor de construção compartilhado pelos algoritmos guloso, DSATUR, GRASP
+ * e GRASP reativo. O laço de construção é único; o que muda entre os algoritmos são
+ * as políticas (seleção de vértice, gerador aleatório e desempate), que são
+ * parâmetros de template e portanto resolvidas em tempo de compilação.
+ */
+
+/**
+ * @brief Candidato de um passo de construção
+ */
+struct Candidate
+{
+    int color;
+    int vertex;
+};
+
+/**
+ * @brief Área de trabalho de um motor (uma por thread)
+ *
+ * Os buffers temporários dos passos de construção vêm de uma arena que é
+ * reiniciada a cada construção; após a primeira iteração o laço de
+ * construção não faz alocações no heap.
+ */
+class SolverWorkspace
+{
+public:
+    /**
+     * @brief Reinicia a arena e reserva os buffers para n vértices
+     */
+    void beginIteration(int n)
+    {
+        arena.reset();
+        candidates.allocate(arena, n);
+        rcl.allocate(arena, n);
+    }
+
+    Arena arena;
+    ArenaArray<Candidate> candidates;
+    ArenaArray<Candidate> rcl;
+
+    // Cores de N1 e N2 do vértice em teste, contíguas para o kernel vetorial
+    std::vector<int> gatherN1;
+    std::vector<int> gatherN2;
+
+    // N2 decodificado do índice comprimido (distance2Neighbors)
+    std::vector<int> decodedN2;
+};
+
+/**
+ * @brief Estado de uma construção: coloração parcial e marcação de vértices
+ */
+class ConstructionState
+{
+public:
+    ConstructionState(const Graph &g, int p, int q);
+
+    /**
+     * @brief Reinicia a coloração (todos os vértices sem cor)
+     */
+    void reset();
+
+    /**
+     * @brief Menor cor positiva válida para v dada a coloração parcial atual
+     * @param v Vértice
+     * @return Cor (>= 1)
+     */
+    int smallestValidColor(int v);
+
+    /**
+     * @brief N2(v) do índice, do índice comprimido (decodificado) ou da cache
+     *
+     * A referência vale até a próxima chamada.
+     */
+    const std::vector<int> &distance2Neighbors(int v);
+
+    /**
+     * @brief Atribui a cor ao vértice
+     */
+    void assign(int v, int color)
+    {
+        coloring[v] = color;
+        colored[v] = 1;
+        ++numColored;
+    }
+
+    const Graph &graph;
+    int p_param;
+    int q_param;
+    std::vector<int> coloring; // 0 = não colorido
+    std::vector<uint8_t> colored; // 1 = colorido (um byte por vértice)
+    int numColored;
+    SolverWorkspace workspace;
+
+private:
+    // N2 sob demanda, criada na primeira consulta se o grafo não tem índice
+    std::unique_ptr<Distance2Cache> distance2Cache;
+};
+
+// ---------------------------------------------------------------------------
+// Políticas de geração de números aleatórios
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Usa std::rand (semente global definida em main via std::srand)
+ *
+ * Conta os sorteios feitos: como o estado de std::rand não é exportável, um
+ * checkpoint guarda a semente e a contagem, e skip() reproduz a sequência.
+ * Com seedLocal() passa a usar um gerador próprio, o que permite execuções
+ * concorrentes e reprodutíveis (ex.: um solver por componente conexa).
+ */
+struct StdRandRng
+{
+    int nextIndex(int bound)
+    {
+        ++draws;
+        return next() % bound;
+    }
+    double nextUnit()
+    {
+        ++draws;
+        return static_cast<double>(next()) / static_cast<double>(RAND_MAX);
+    }
+
+    /**
+     * @brief Descarta count sorteios da sequência global
+     */
+    void skip(uint64_t count)
+    {
+        for (uint64_t i = 0; i < count; ++i)
+            next();
+        draws += count;
+    }
+
+    /**
+     * @brief Troca std::rand por um gerador local com a semente dada
+     */
+    void seedLocal(unsigned seed)
+    {
+        local.seed(seed);
+        useLocal = true;
+    }
+
+    uint64_t draws = 0;
+
+private:
+    std::minstd_rand local;
+    bool useLocal = false;
+
+    int next()
+    {
+        if (!useLocal)
+            return std::rand();
+        return static_cast<int>(local() % (static_cast<unsigned long>(RAND_MAX) + 1ul));
+    }
+};
+
+/**
+ * @brief Mersenne Twister com estado próprio (independente da semente global)
+ */
+class MersenneRng
+{
+public:
+    explicit MersenneRng(unsigned int seed = 5489u) : gen(seed) {}
+
+    void seed(unsigned int s) { gen.seed(s); }
+
+    int nextIndex(int bound)
+    {
+        return std::uniform_int_distribution<int>(0, bound - 1)(gen);
+    }
+    double nextUnit()
+    {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(gen);
+    }
+
+    std::mt19937 &engine() { return gen; }
+
+private:
+    std::mt19937 gen;
+};
+
+// ---------------------------------------------------------------------------
+// Políticas de desempate (menor chave vence)
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Desempata pelo menor id de vértice
+ */
+struct LowestIdTieBreak
+{
+    template <typename Rng>
+    void reset(int, Rng &) {}
+    int key(int v) const { return v; }
+};
+
+// ---------------------------------------------------------------------------
+// Políticas de seleção de vértice
+//
+// Interface esperada:
+//   template <Rng, TieBreak> void reset(const ConstructionState&, Rng&, TieBreak&)
+//   template <Rng, TieBreak> bool select(ConstructionState&, Rng&, const TieBreak&,
+//                                        int &vertex, int &color)
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Percorre os vértices em ordem fixa (grau decrescente por padrão)
+ */
+class StaticOrderSelection
+{
+public:
+    StaticOrderSelection() = default;
+    explicit StaticOrderSelection(std::vector<int> fixedOrder) : order(std::move(fixedOrder)), useFixed(true) {}
+
+    template <typename Rng, typename TieBreak>
+    void reset(const ConstructionState &state, Rng &, TieBreak &tieBreak)
+    {
+        pos = 0;
+        if (useFixed)
+            return;
+
+        const Graph &g = state.graph;
+        int n = g.getNumVertices();
+        order.resize(n);
+        for (int i = 0; i < n; ++i)
+            order[i] = i;
+        VertexOrdering::sortByDegree(g, order, [&tieBreak](int v)
+                                     { return tieBreak.key(v); });
+    }
+
+    template <typename Rng, typename TieBreak>
+    bool select(ConstructionState &state, Rng &, const TieBreak &, int &vertex, int &color)
+    {
+        if (pos >= order.size())
+            return false;
+        vertex = order[pos++];
+        color = state.smallestValidColor(vertex);
+        return true;
+    }
+
+private:
+    std::vector<int> order;
+    size_t pos = 0;
+    bool useFixed = false;
+};
+
+/**
+ * @brief Lista restrita de candidatos (RCL) do GRASP
+ *
+ * Um candidato entra na RCL se cor <= cMin + alpha * (cMax - cMin); o
+ * escolhido é sorteado uniformemente dentre os membros da RCL.
+ *
+ * No modo amostrado, cada passo avalia apenas uma amostra aleatória de
+ * vértices não coloridos (tamanho fixo ou fração de n) e aplica a mesma
+ * regra de limiar sobre ela.
+ */
+class RCLSelection
+{
+public:
+    explicit RCLSelection(double a = 0.0) : alpha(a) {}
+
+    void setAlpha(double a) { alpha = a; }
+    double getAlpha() const { return alpha; }
+
+    /**
+     * @brief Configura a amostragem: size > 0 fixa o tamanho; senão, fraction
+     * em (0, 1] define a fração de n; ambos 0 avaliam todos os vértices
+     */
+    void setSample(int size, double fraction)
+    {
+        sampleSize = std::max(0, size);
+        sampleFraction = std::max(0.0, fraction);
+    }
+
+    bool isSampled() const { return sampleSize > 0 || sampleFraction > 0.0; }
+
+    /**
+     * @brief Tamanho efetivo da amostra para um grafo com n vértices
+     */
+    int effectiveSampleSize(int n) const
+    {
+        if (sampleSize > 0)
+            return std::min(sampleSize, n);
+        if (sampleFraction > 0.0)
+            return std::max(1, std::min(n, static_cast<int>(std::ceil(sampleFraction * n))));
+        return n;
+    }
+
+    template <typename Rng, typename TieBreak>
+    void reset(const ConstructionState &state, Rng &, TieBreak &)
+    {
+        if (!isSampled())
+            return;
+
+        // Lista de vértices não coloridos com remoção O(1)
+        int n = state.graph.getNumVertices();
+        activeSample = effectiveSampleSize(n);
+        uncolored.resize(n);
+        position.resize(n);
+        for (int v = 0; v < n; ++v)
+        {
+            uncolored[v] = v;
+            position[v] = v;
+        }
+    }
+
+    template <typename Rng, typename TieBreak>
+    bool select(ConstructionState &state, Rng &rng, const TieBreak &, int &vertex, int &color)
+    {
+        int n = state.graph.getNumVertices();
+
+        // Para cada vértice não colorido (ou amostrado), calcular a menor cor válida
+        ArenaArray<Candidate> &candidates = state.workspace.candidates;
+        candidates.clear();
+        if (isSampled())
+        {
+            int remaining = static_cast<int>(uncolored.size());
+            int k = std::min(activeSample, remaining);
+            // Fisher-Yates parcial: as k primeiras posições formam a amostra
+            for (int i = 0; i < k; ++i)
+            {
+                int j = i + rng.nextIndex(remaining - i);
+                swapUncolored(i, j);
+                candidates.push_back({state.smallestValidColor(uncolored[i]), uncolored[i]});
+            }
+        }
+        else
+        {
+            for (int v = 0; v < n; ++v)
+            {
+                if (state.colored[v])
+                    continue;
+                candidates.push_back({state.smallestValidColor(v), v});
+            }
+        }
+
+        if (candidates.empty())
+            return false;
+
+        int cMin = INT_MAX, cMax = INT_MIN;
+        for (const Candidate &c : candidates)
+        {
+            cMin = std::min(cMin, c.color);
+            cMax = std::max(cMax, c.color);
+        }
+
+        double threshold = cMin + alpha * (cMax - cMin);
+        ArenaArray<Candidate> &rcl = state.workspace.rcl;
+        rcl.clear();
+        for (const Candidate &c : candidates)
+        {
+            if (c.color <= threshold)
+                rcl.push_back(c);
+        }
+
+        int idx = rng.nextIndex(static_cast<int>(rcl.size()));
+        vertex = rcl[idx].vertex;
+        color = rcl[idx].color;
+
+        if (isSampled())
+        {
+            swapUncolored(position[vertex], static_cast<int>(uncolored.size()) - 1);
+            uncolored.pop_back();
+        }
+        return true;
+    }
+
+private:
+    double alpha;
+    int sampleSize = 0;
+    double sampleFraction = 0.0;
+    int activeSample = 0;
+    std::vector<int> uncolored;
+    std::vector<int> position;
+
+    void swapUncolored(int i, int j)
+    {
+        std::swap(uncolored[i], uncolored[j]);
+        position[uncolored[i]] = i;
+        position[uncolored[j]] = j;
+    }
+};
+
+/**
+ * @brief Seleção por saturação (DSATUR)
+ *
+ * A saturação de um vértice é o número de cores distintas que os vizinhos
+ * já coloridos lhe proíbem (|c - c(u)| < p em N1, < q em N2). É escolhido o
+ * vértice de maior saturação (empate: maior grau em G², depois a política de
+ * desempate), com a menor cor livre.
+ *
+ * Cada vértice não colorido guarda, por cor, quantos vizinhos coloridos a
+ * proíbem; ao escolher v apenas N1(v) e N2(v) são atualizados, e a fila é um
+ * heap com remoção preguiçosa (entradas velhas são descartadas ao sair).
+ * Custo O((n + Σ|N2|) log n) por construção em vez de O(n²).
+ */
+class SaturationSelection
+{
+public:
+    template <typename Rng, typename TieBreak>
+    void reset(const ConstructionState &, Rng &, TieBreak &)
+    {
+        pending = true;
+        heapPops = 0;
+    }
+
+    template <typename Rng, typename TieBreak>
+    bool select(ConstructionState &state, Rng &, const TieBreak &tieBreak, int &vertex, int &color)
+    {
+        if (pending)
+            initialize(state, tieBreak);
+
+        while (!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            Entry top = heap.back();
+            heap.pop_back();
+            ++heapPops;
+            const int v = top.vertex;
+            if (state.colored[v] || top.saturation != saturation[v])
+                continue; // entrada velha
+
+            // Menor cor livre
+            std::vector<uint32_t> &counts = blocked[v];
+            int c = 1;
+            while (c < static_cast<int>(counts.size()) && counts[c] != 0)
+                ++c;
+            std::vector<uint32_t>().swap(counts);
+
+            // O motor atribui (v, c) em seguida: v já não recebe atualizações
+            auto update = [&](const std::vector<int> &nbrs, int separation)
+            {
+                for (int u : nbrs)
+                {
+                    if (u != v && !state.colored[u] && block(u, c, separation))
+                        push(u, tieBreak);
+                }
+            };
+            update(state.graph.getNeighbors(v), state.p_param);
+            update(state.distance2Neighbors(v), state.q_param);
+
+            vertex = v;
+            color = c;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Entradas retiradas do heap na última construção (incluindo as velhas)
+     */
+    long long getHeapPops() const { return heapPops; }
+
+private:
+    struct Entry
+    {
+        int saturation;
+        int squareDegree;
+        int key; // chave de desempate negada: a menor chave sai primeiro
+        int vertex;
+
+        bool operator<(const Entry &o) const
+        {
+            if (saturation != o.saturation)
+                return saturation < o.saturation;
+            if (squareDegree != o.squareDegree)
+                return squareDegree < o.squareDegree;
+            return key < o.key;
+        }
+    };
+
+    std::vector<Entry> heap;
+    std::vector<int> saturation;
+    std::vector<int> squareDegree;
+    std::vector<std::vector<uint32_t>> blocked; // blocked[v][c]: vizinhos coloridos que proíbem c
+    bool pending = true;
+    long long heapPops = 0;
+
+    template <typename TieBreak>
+    void initialize(ConstructionState &state, const TieBreak &tieBreak)
+    {
+        pending = false;
+        const int n = state.graph.getNumVertices();
+        saturation.assign(n, 0);
+        blocked.assign(n, {});
+        squareDegree.resize(n);
+        heap.clear();
+        for (int v = 0; v < n; ++v)
+        {
+            squareDegree[v] = static_cast<int>(state.graph.getNeighbors(v).size() + state.distance2Neighbors(v).size());
+            push(v, tieBreak);
+        }
+    }
+
+    template <typename TieBreak>
+    void push(int v, const TieBreak &tieBreak)
+    {
+        heap.push_back({saturation[v], squareDegree[v], -tieBreak.key(v), v});
+        std::push_heap(heap.begin(), heap.end());
+    }
+
+    // Um vizinho com cor c proíbe [c - separation + 1, c + separation - 1] a u;
+    // devolve true se a saturação de u mudou
+    bool block(int u, int c, int separation)
+    {
+        if (separation <= 0)
+            return false;
+        std::vector<uint32_t> &counts = blocked[u];
+        const int lo = std::max(1, c - separation + 1);
+        const int hi = c + separation - 1;
+        if (static_cast<int>(counts.size()) <= hi)
+            counts.resize(hi + 1, 0);
+
+        bool changed = false;
+        for (int k = lo; k <= hi; ++k)
+        {
+            if (counts[k]++ == 0)
+            {
+                ++saturation[u];
+                changed = true;
+            }
+        }
+        return changed;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Motor
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Laço de construção parametrizado por políticas
+ *
+ * A cada passo a política de seleção escolhe um par (vértice, cor); o motor
+ * apenas o aplica até que todos os vértices estejam coloridos.
+ */
+template <typename Selection, typename Rng = StdRandRng, typename TieBreak = LowestIdTieBreak>
+class ConstructionEngine
+{
+public:
+    ConstructionEngine(const Graph &g, int p, int q,
+                       Selection sel = Selection(),
+                       Rng r = Rng(),
+                       TieBreak tb = TieBreak())
+        : state(g, p, q), selectionPolicy(std::move(sel)), rngPolicy(std::move(r)), tieBreakPolicy(std::move(tb))
+    {
+    }
+
+    /**
+     * @brief Executa uma construção completa
+     * @return Coloração (cores >= 1), válida até a próxima construção
+     */
+    const std::vector<int> &construct()
+    {
+        constructBelow(INT_MAX);
+        return state.coloring;
+    }
+
+    /**
+     * @brief Construção abandonada assim que alguma cor chega a cutoff
+     *
+     * Usada para descartar construções que não podem melhorar um incumbente.
+     * @return false se abandonada (a coloração em current() fica incompleta)
+     */
+    bool constructBelow(int cutoff)
+    {
+        int n = state.graph.getNumVertices();
+        state.reset();
+        state.workspace.beginIteration(n);
+        tieBreakPolicy.reset(n, rngPolicy);
+        selectionPolicy.reset(state, rngPolicy, tieBreakPolicy);
+
+        for (int count = 0; count < n; ++count)
+        {
+            int v, color;
+            if (!selectionPolicy.select(state, rngPolicy, tieBreakPolicy, v, color))
+                break;
+            if (color >= cutoff)
+                return false;
+            state.assign(v, color);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Coloração da última construção
+     */
+    const std::vector<int> &current() const { return state.coloring; }
+
+    Selection &selection() { return selectionPolicy; }
+    const Selection &selection() const { return selectionPolicy; }
+    Rng &rng() { return rngPolicy; }
+
+private:
+    ConstructionState state;
+    Selection selectionPolicy;
+    Rng rngPolicy;
+    TieBreak tieBreakPolicy;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Graph.h"
+#include "ConstructionEngine.h"
+#include <vector>
+
+/**
+ * Guloso por saturação (DSATUR) para L(p,q)-coloring: o motor de construção
+ * com a política SaturationSelection.
+ */
+class DSaturAlgorithm
+{
+public:
+    DSaturAlgorithm(const Graph &g, int p, int q);
+
+    std::vector<int> solve();
+
+    /**
+     * @brief Entradas retiradas do heap na última execução (incluindo as velhas)
+     */
+    long long getHeapPops() const { return engine.selection().getHeapPops(); }
+
+private:
+    ConstructionEngine<SaturationSelection, StdRandRng, LowestIdTieBreak> engine;
+};
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Graph.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * Vizinhanças a distância 2 calculadas sob demanda, para grafos cujo G²
+ * completo (Σ grau² entradas) não cabe na memória.
+ *
+ * Em uma falta, N2(v) é obtido percorrendo os vizinhos dos vizinhos com um
+ * vetor de marcas reaproveitado (sem conjuntos nem alocação por consulta) e
+ * guardado em uma cache limitada por um orçamento de bytes. Quando o
+ * orçamento estoura, fatias são despejadas pela política CLOCK (segunda
+ * chance): cada acerto marca a fatia como referenciada, e o ponteiro só
+ * despeja fatias não referenciadas desde a última volta. Fatias maiores que
+ * o orçamento inteiro não são guardadas.
+ *
+ * Não é thread-safe: cada motor de construção usa a sua.
+ */
+class Distance2Cache
+{
+public:
+    /**
+     * @brief Contadores de uso da cache
+     */
+    struct Metrics
+    {
+        long long hits = 0;
+        long long misses = 0;
+        long long evictions = 0;
+        long long bypasses = 0; // faltas de fatias maiores que o orçamento
+        size_t budgetBytes = 0;
+        size_t peakBytes = 0;   // maior ocupação das fatias guardadas
+
+        double hitRate() const
+        {
+            long long total = hits + misses;
+            return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+        }
+    };
+
+    /**
+     * @param g Grafo (o índice de distância 2 não é necessário)
+     * @param budgetBytes Bytes para as fatias guardadas (0 = sempre recalcula)
+     */
+    Distance2Cache(const Graph &g, size_t budgetBytes);
+
+    /**
+     * @brief Soma os contadores desta cache aos totais do processo
+     */
+    ~Distance2Cache();
+
+    Distance2Cache(const Distance2Cache &) = delete;
+    Distance2Cache &operator=(const Distance2Cache &) = delete;
+
+    /**
+     * @brief Vértices a distância exatamente 2 de v, em ordem crescente
+     *
+     * A referência vale até a próxima chamada de get.
+     */
+    const std::vector<int> &get(int v);
+
+    const Metrics &getMetrics() const { return metrics; }
+
+    /**
+     * @brief Bytes ocupados pelas fatias guardadas
+     */
+    size_t getUsedBytes() const { return usedBytes; }
+
+    /**
+     * @brief Orçamento usado pelos motores de construção quando o grafo não
+     * tem índice de distância 2
+     */
+    static void setDefaultBudget(size_t bytes);
+    static size_t getDefaultBudget();
+
+    /**
+     * @brief Contadores somados de todas as caches já destruídas (ex.: uma por thread)
+     */
+    static Metrics totals();
+    static void resetTotals();
+
+    /**
+     * @brief Imprime acertos, faltas, taxa de acerto, despejos e ocupação
+     */
+    static void printMetrics(const Metrics &m, std::ostream &out, const char *indent = "  ");
+
+private:
+    const Graph &graph;
+    size_t budget;
+    size_t usedBytes;
+    Metrics metrics;
+
+    std::vector<std::vector<int>> slices; // fatia guardada de cada vértice
+    std::vector<uint8_t> resident;
+    std::vector<uint8_t> referenced;
+    std::vector<int> ring; // vértices residentes, percorridos pelo ponteiro CLOCK
+    size_t hand;
+
+    std::vector<int> mark; // mark[x] == stamp: x já visto na varredura atual
+    int stamp;
+    std::vector<int> scratch;
+
+    void scan(int v);
+    void evictFor(size_t bytes);
+};
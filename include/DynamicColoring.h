@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Graph.h"
+#include <string>
+#include <vector>
+
+/**
+ * Manutenção de uma coloração sob alterações do grafo.
+ *
+ * As alterações são aplicadas ao grafo (que mantém o índice de distância 2
+ * incrementalmente) e acumuladas em um lote; repair() recolore apenas os
+ * vértices cujas restrições N1/N2 passaram a ser violadas.
+ *
+ * Arquivo de alterações (vértices 0-based, como na saída -o):
+ *   + u v     insere a aresta {u, v}
+ *   - u v     remove a aresta {u, v}
+ *   +v        insere um vértice (recebe o próximo id)
+ *   -v u      remove o vértice u (suas arestas; os ids não mudam)
+ *   commit    encerra o lote e repara (o fim do arquivo também encerra)
+ * Linhas vazias ou iniciadas por # são ignoradas.
+ */
+class DynamicColoring
+{
+public:
+    /**
+     * @brief Estatísticas de um lote
+     */
+    struct BatchStats
+    {
+        int changes;       // alterações aplicadas
+        int checked;       // vértices verificados
+        int recolored;     // vértices recoloridos
+        int maxColor;      // maior cor após o reparo
+        double applySeconds;  // atualização do grafo e do índice
+        double repairSeconds; // verificação e recoloração
+    };
+
+    /**
+     * @param g Grafo com o índice de distância 2 construído
+     * @param coloring Coloração válida de g
+     */
+    DynamicColoring(Graph &g, int p, int q, const std::vector<int> &coloring);
+
+    void addEdge(int u, int v);
+    void removeEdge(int u, int v);
+    int addVertex();
+    void removeVertex(int v);
+
+    /**
+     * @brief Repara a coloração após as alterações do lote corrente
+     */
+    BatchStats repair();
+
+    /**
+     * @brief Aplica um arquivo de alterações, reparando a cada lote
+     * @param filename Arquivo de alterações
+     * @param stats Estatísticas de cada lote
+     * @return false se o arquivo não pôde ser lido ou contém linha inválida
+     */
+    bool applyChangeLog(const std::string &filename, std::vector<BatchStats> &stats);
+
+    const std::vector<int> &getColoring() const { return coloring; }
+
+private:
+    Graph &graph;
+    int p_param;
+    int q_param;
+    std::vector<int> coloring;
+
+    // Vértices a verificar no próximo reparo
+    std::vector<int> dirty;
+    std::vector<int> dirtyMark;
+    int dirtyStamp;
+    int pendingChanges;
+    double pendingApplySeconds;
+
+    std::vector<int> gatherN1;
+    std::vector<int> gatherN2;
+
+    void markDirty(int v);
+    bool violates(int v) const;
+    int smallestValidColor(int v);
+};
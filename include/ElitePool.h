@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * Conjunto elite de colorações: guarda as melhores soluções encontradas,
+ * exigindo uma distância mínima entre os membros para manter diversidade.
+ */
+class ElitePool
+{
+public:
+    /**
+     * @param capacity Número máximo de membros
+     * @param minDistance Distância mínima (vértices com cores diferentes) entre membros
+     */
+    ElitePool(int capacity, int minDistance);
+
+    /**
+     * @brief Tenta inserir uma coloração no conjunto
+     *
+     * Com o conjunto incompleto, entra se for distante de todos os membros.
+     * Cheio, entra se for melhor que o melhor membro, ou melhor que o pior e
+     * distante de todos; substitui o membro mais parecido dentre os que não
+     * são melhores que ela.
+     *
+     * @return true se a coloração foi inserida
+     */
+    bool tryInsert(const std::vector<int> &coloring, int maxColor);
+
+    /**
+     * @brief Acrescenta um membro sem os testes de entrada (retomada de checkpoint)
+     */
+    void restore(const std::vector<int> &coloring, int maxColor) { entries.push_back({coloring, maxColor}); }
+
+    bool empty() const { return entries.empty(); }
+    int size() const { return static_cast<int>(entries.size()); }
+    const std::vector<int> &member(int i) const { return entries[i].coloring; }
+    int memberMaxColor(int i) const { return entries[i].maxColor; }
+
+    /**
+     * @brief Diferença simétrica entre duas colorações
+     * @return Número de vértices com cores diferentes
+     */
+    static int distance(const std::vector<int> &a, const std::vector<int> &b);
+
+private:
+    struct Entry
+    {
+        std::vector<int> coloring;
+        int maxColor;
+    };
+
+    int capacity;
+    int minDistance;
+    std::vector<Entry> entries;
+};
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "Graph.h"
+#include "ConstructionEngine.h"
+#include "SharedIncumbent.h"
+#include "WorkStealingScheduler.h"
+#include <algorithm>
 #include <vector>
 
 class GRASPAlgorithm {
@@ -9,6 +13,61 @@ public:
     std::vector<int> solve();
     
     double getAverageSolution() const { return averageSolution; }
+    int getIterationsExecuted() const { return iterationsExecuted; }
+
+    /**
+     * @brief Define um limite inferior; a busca para ao atingi-lo (ótimo provado)
+     */
+    void setLowerBound(int bound) { lowerBound = bound; }
+
+    /**
+     * @brief Ativa o conjunto elite com religamento de caminhos (0 desativa)
+     */
+    void setEliteSize(int size) { eliteSize = size; }
+    int getRelinkImprovements() const { return relinkImprovements; }
+
+    /**
+     * @brief RCL amostrada: size > 0 vértices por passo, ou fraction de n (0 desativa)
+     */
+    void setRCLSample(int size, double fraction);
+
+    /**
+     * @brief Tamanho da amostra avaliada por passo (0 = todos os vértices)
+     */
+    int getRCLSampleSize() const;
+
+    /**
+     * @brief Solução inicial válida: incumbente, limite superior e semente do conjunto elite
+     */
+    void setInitialSolution(const std::vector<int> &coloring) { initialSolution = coloring; }
+
+    /**
+     * @brief Usa um gerador próprio com esta semente em vez de std::rand
+     */
+    void setRandomSeed(unsigned int seed)
+    {
+        hasLocalSeed = true;
+        localSeed = seed;
+        engine.rng().seedLocal(seed);
+    }
+
+    /**
+     * @brief Número de threads; com mais de uma (e sem conjunto elite, cuja
+     * ordem de inserção é serial), as iterações viram tarefas de um
+     * escalonador com roubo de trabalho
+     */
+    void setNumThreads(int threads) { numThreads = std::max(1, threads); }
+
+    /**
+     * @brief Tarefas, roubos e ocupação de cada worker na última execução paralela
+     */
+    const std::vector<WorkStealingScheduler::WorkerStats> &getSchedulerStats() const { return schedulerStats; }
+
+    /**
+     * @brief Incumbente compartilhado: publica melhoras, abandona construções
+     * que não podem superá-lo e para quando ele sinaliza
+     */
+    void setIncumbent(SharedIncumbent *shared) { incumbent = shared; }
 
 private:
     const Graph &graph;
@@ -17,7 +76,18 @@ private:
     double alpha;
     int iterations;
     double averageSolution;
+    int iterationsExecuted;
+    int lowerBound;
+    int eliteSize;
+    int relinkImprovements;
+    std::vector<int> initialSolution;
+    SharedIncumbent *incumbent;
+    int numThreads;
+    bool hasLocalSeed;
+    unsigned int localSeed;
+    std::vector<WorkStealingScheduler::WorkerStats> schedulerStats;
+
+    ConstructionEngine<RCLSelection, StdRandRng, LowestIdTieBreak> engine;
 
-    std::vector<int> constructGreedyRandomized();
-    int findSmallestValidColor(int v, const std::vector<int> &coloring);
+    std::vector<int> solveParallel();
 };
@@ -1,11 +1,14 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
 
+class CompressedDistance2;
+
 class Graph
 {
 private:
@@ -15,8 +18,26 @@ private:
     std::vector<int> vertexWeights;
     std::unordered_map<std::string, int> edgeWeights;
 
+    // Índice de vizinhanças a distância 2 (listas ordenadas, sem repetição)
+    std::vector<std::vector<int>> distance2Lists;
+    bool distance2Built;
+
+    // Índice comprimido (substitui as listas; descartado se o grafo muda)
+    std::shared_ptr<const CompressedDistance2> compressedDistance2;
+
+    // Marcador usado na atualização incremental do índice
+    std::vector<int> distance2Mark;
+    int distance2Stamp;
+
     std::string getEdgeKey(int u, int v) const;
 
+    void computeDistance2List(int v, std::vector<int> &mark, int stamp);
+    int markNeighbors(int v);
+    void linkDistance2(int a, int b);
+    void unlinkDistance2(int a, int b);
+    void indexEdgeAdded(int u, int v);
+    void indexEdgeRemoved(int u, int v);
+
 public:
     /**
      * @brief Construtor
@@ -27,12 +48,38 @@ public:
 
     /**
      * @brief Adiciona uma aresta ao grafo
+     *
+     * Se o índice de distância 2 estiver construído, ele é atualizado
+     * incrementalmente (apenas pares com uma extremidade em u ou v mudam).
+     *
      * @param u Vértice origem
      * @param v Vértice destino
      * @param weight Peso da aresta (opcional)
      */
     void addEdge(int u, int v, int weight = 1);
 
+    /**
+     * @brief Remove a aresta {u, v} (todas as cópias), mantendo o índice de distância 2
+     * @return true se a aresta existia
+     */
+    bool removeEdge(int u, int v);
+
+    /**
+     * @brief Verifica se existe a aresta {u, v}
+     */
+    bool hasEdge(int u, int v) const;
+
+    /**
+     * @brief Acrescenta um vértice isolado
+     * @return Id do novo vértice
+     */
+    int addVertex();
+
+    /**
+     * @brief Remove todas as arestas de v; os ids dos demais vértices não mudam
+     */
+    void removeVertex(int v);
+
     /**
      * @brief Define o peso de um vértice
      * @param v Vértice
@@ -67,6 +114,48 @@ public:
      */
     std::unordered_set<int> getVerticesAtDistance2(int v) const;
 
+    /**
+     * @brief Constrói o índice de vértices a distância 2 para todos os vértices
+     *
+     * Deve ser chamado após a carga do grafo; a partir daí addEdge, removeEdge
+     * e addVertex o mantêm atualizado (clear o descarta).
+     */
+    void buildDistance2Index();
+
+    /**
+     * @brief Usa listas de distância 2 fornecidas (ordenadas, sem repetição)
+     *
+     * Para subgrafos que herdam restrições de um grafo maior: pares ligados
+     * por caminhos que saem do subgrafo continuam restritos.
+     */
+    void setDistance2Index(std::vector<std::vector<int>> lists);
+
+    /**
+     * @brief Troca as listas do índice de distância 2 pela versão comprimida
+     *
+     * As listas de int são liberadas e hasDistance2Index passa a ser falso;
+     * quem sabe iterar a versão comprimida a obtém com getCompressedDistance2.
+     * Qualquer alteração do grafo descarta o índice comprimido.
+     */
+    void setCompressedDistance2Index(std::shared_ptr<const CompressedDistance2> index);
+
+    /**
+     * @brief Índice comprimido de distância 2 (nullptr se não houver)
+     */
+    const CompressedDistance2 *getCompressedDistance2() const { return compressedDistance2.get(); }
+
+    /**
+     * @brief Verifica se o índice de distância 2 está construído
+     */
+    bool hasDistance2Index() const { return distance2Built; }
+
+    /**
+     * @brief Obtém os vértices a distância 2 de v a partir do índice
+     * @param v Vértice
+     * @return Lista ordenada de vértices a distância exatamente 2
+     */
+    const std::vector<int> &getDistance2Neighbors(int v) const;
+
     /**
      * @brief Verifica se o grafo é direcionado
      */
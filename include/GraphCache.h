@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Graph.h"
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Cache LRU de grafos já carregados e com o índice de distância 2 pronto,
+ * compartilhado entre as requisições do servidor.
+ *
+ * A chave inclui o caminho, a data de modificação e o tamanho do arquivo:
+ * um arquivo reescrito é recarregado. A leitura acontece fora da trava, e
+ * requisições simultâneas pelo mesmo arquivo esperam a mesma carga.
+ */
+class GraphCache
+{
+public:
+    /**
+     * @brief Grafo carregado (imutável depois de pronto)
+     */
+    struct Entry
+    {
+        std::shared_ptr<const Graph> graph; // nulo se a leitura falhou
+        double loadSeconds = 0.0;
+        double indexSeconds = 0.0;
+    };
+
+    /**
+     * @param capacity Número máximo de grafos mantidos (>= 1)
+     */
+    explicit GraphCache(size_t capacity);
+
+    /**
+     * @brief Devolve o grafo do arquivo, carregando-o se necessário
+     * @param hit Saída: true se o grafo já estava no cache (ou sendo carregado)
+     * @param error Mensagem quando o grafo não pôde ser obtido
+     */
+    Entry get(const std::string &filename, bool &hit, std::string &error);
+
+    size_t getHits() const;
+    size_t getMisses() const;
+    size_t getSize() const;
+    size_t getCapacity() const { return capacity; }
+
+private:
+    struct Slot
+    {
+        std::shared_future<Entry> entry;
+        std::list<std::string>::iterator position; // posição na ordem de uso
+    };
+
+    const size_t capacity;
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Slot> slots;
+    std::list<std::string> order; // mais recente primeiro
+    size_t hits;
+    size_t misses;
+
+    static Entry load(const std::string &filename);
+};
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Escritor de arestas em fluxo (DIMACS ou binário).
+ *
+ * As arestas são gravadas à medida que são geradas; o total de arestas,
+ * desconhecido de antemão, é preenchido no cabeçalho ao final (campo de
+ * largura fixa), então a memória usada não depende do número de arestas.
+ *
+ * Formato binário (little-endian):
+ *   "LPQB" | uint32 versão | uint32 n | uint64 m | m pares uint32 (u, v) 0-based
+ */
+class EdgeStreamWriter
+{
+public:
+    enum class Format
+    {
+        Dimacs,
+        Binary
+    };
+
+    EdgeStreamWriter(const std::string &filename, Format format);
+    ~EdgeStreamWriter();
+
+    EdgeStreamWriter(const EdgeStreamWriter &) = delete;
+    EdgeStreamWriter &operator=(const EdgeStreamWriter &) = delete;
+
+    bool isOpen() const { return file != nullptr; }
+
+    /**
+     * @brief Escreve o cabeçalho (deve ser chamado antes da primeira aresta)
+     * @param n Número de vértices
+     * @param comment Comentário gravado no arquivo DIMACS
+     */
+    void begin(int n, const std::string &comment);
+
+    /**
+     * @brief Grava a aresta {u, v} (vértices 0-based)
+     */
+    void edge(int u, int v);
+
+    /**
+     * @brief Completa o cabeçalho com o total de arestas e fecha o arquivo
+     * @return true se todas as escritas tiveram sucesso
+     */
+    bool finish();
+
+    uint64_t getNumEdges() const { return numEdges; }
+
+private:
+    FILE *file;
+    Format format;
+    uint64_t numEdges;
+    long countOffset; // posição do campo com o total de arestas
+    std::vector<char> buffer;
+};
+
+/**
+ * Geradores sintéticos de instâncias, todos reprodutíveis pela semente.
+ */
+class GraphGenerator
+{
+public:
+    /**
+     * @brief Erdős–Rényi G(n, p) por saltos geométricos (tempo O(n + m))
+     */
+    static void gnp(EdgeStreamWriter &out, int n, double p, uint64_t seed);
+
+    /**
+     * @brief Grafo geométrico aleatório (disco unitário): n pontos no
+     * quadrado unitário, aresta se a distância for <= radius
+     *
+     * Usa uma grade de células de lado radius; memória O(n) para os pontos.
+     */
+    static void geometric(EdgeStreamWriter &out, int n, double radius, uint64_t seed);
+
+    /**
+     * @brief Estilo DSJR (Johnson et al.): mesmos pontos do grafo geométrico;
+     * com complement, gera o complemento (família r*.c)
+     */
+    static void dsjr(EdgeStreamWriter &out, int n, double radius, bool complement, uint64_t seed);
+
+    /**
+     * @brief Grade rows x cols com vizinhança de 4
+     */
+    static void grid(EdgeStreamWriter &out, int rows, int cols);
+
+    /**
+     * @brief Grade hexagonal rows x cols (células com 6 vizinhas)
+     */
+    static void hex(EdgeStreamWriter &out, int rows, int cols);
+
+    /**
+     * @brief Subcomando "generate" da linha de comando
+     * @return Código de saída do processo
+     */
+    static int runCommand(int argc, char *argv[]);
+
+private:
+    static void samplePoints(int n, uint64_t seed, std::vector<double> &xs, std::vector<double> &ys);
+};
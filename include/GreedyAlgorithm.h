@@ -1,15 +1,20 @@
 #pragma once
 
 #include "Graph.h"
+#include "ConstructionEngine.h"
 #include <vector>
 
 class GreedyAlgorithm {
 public:
     GreedyAlgorithm(const Graph &g, int p, int q);
+
+    /**
+     * @brief Guloso na ordem dada (ex.: VertexOrdering) em vez do grau decrescente
+     */
+    GreedyAlgorithm(const Graph &g, int p, int q, std::vector<int> order);
+
     std::vector<int> solve();
 
 private:
-    const Graph &graph;
-    int p_param;
-    int q_param;
+    ConstructionEngine<StaticOrderSelection, StdRandRng, LowestIdTieBreak> engine;
 };
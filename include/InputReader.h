@@ -47,6 +47,17 @@ public:
      */
     static bool readGraphAdjList(const std::string &filename, Graph &graph);
 
+    /**
+     * @brief Lê um grafo no formato binário gerado pelo subcomando generate
+     *
+     * Formato: "LPQB" | uint32 versão | uint32 n | uint64 m | m pares uint32 (0-based)
+     *
+     * @param filename Nome do arquivo
+     * @param graph Referência ao grafo que será preenchido
+     * @return true se a leitura foi bem-sucedida, false caso contrário
+     */
+    static bool readGraphBinary(const std::string &filename, Graph &graph);
+
     /**
      * @brief Detecta automaticamente o formato e lê o grafo
      * @param filename Nome do arquivo
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * JSON mínimo para o protocolo do servidor: um objeto por linha, com
+ * valores escalares (texto, número, booleano ou null).
+ */
+class JsonLine
+{
+public:
+    struct Value
+    {
+        enum class Type
+        {
+            String,
+            Number,
+            Bool,
+            Null
+        };
+        Type type = Type::Null;
+        std::string text; // texto (sem aspas) ou número como escrito
+        bool boolean = false;
+
+        /**
+         * @brief Representação JSON do valor (para ecoar o id da requisição)
+         */
+        std::string raw() const;
+    };
+
+    /**
+     * @brief Lê um objeto plano {"chave": valor, ...}
+     * @return false (com mensagem em error) se a linha não é um objeto válido
+     */
+    static bool parseObject(const std::string &line, std::map<std::string, Value> &fields, std::string &error);
+
+    /**
+     * @brief Texto entre aspas com os escapes de JSON
+     */
+    static std::string quote(const std::string &text);
+};
+
+/**
+ * Montagem incremental de um objeto JSON de uma linha.
+ */
+class JsonBuilder
+{
+public:
+    JsonBuilder &add(const std::string &key, const std::string &value);
+    JsonBuilder &add(const std::string &key, const char *value) { return add(key, std::string(value)); }
+    JsonBuilder &add(const std::string &key, long long value);
+    JsonBuilder &add(const std::string &key, int value) { return add(key, static_cast<long long>(value)); }
+    JsonBuilder &add(const std::string &key, double value);
+    JsonBuilder &add(const std::string &key, bool value);
+    JsonBuilder &add(const std::string &key, const std::vector<int> &values);
+
+    /**
+     * @brief Valor já em JSON (ex.: JsonLine::Value::raw)
+     */
+    JsonBuilder &addRaw(const std::string &key, const std::string &json);
+
+    /**
+     * @brief Objeto completo, terminado em '\n'
+     */
+    std::string line() const { return "{" + body + "}\n"; }
+
+private:
+    std::string body;
+
+    void key(const std::string &name);
+};
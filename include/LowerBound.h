@@ -0,0 +1,70 @@
+#ifndef LOWER_BOUND_H
+#define LOWER_BOUND_H
+
+#include "Graph.h"
+#include <vector>
+
+/**
+ * Limites inferiores baratos e válidos para a maior cor de uma
+ * L(p,q)-coloração com cores a partir de 1 (maior cor = span + 1).
+ */
+class LowerBound
+{
+public:
+    /**
+     * @brief Limite pelo grau máximo (estrela fechada de um vértice)
+     *
+     * Os vizinhos de v estão a distância <= 2 entre si e a distância 1 de v.
+     * Para p >= q: span >= p + (Δ - 1) q; para p < q: span >= max(Δ p, (Δ - 1) q),
+     * pois as Δ folhas também distam q entre si.
+     *
+     * @return Limite para a maior cor
+     */
+    static int degreeBound(const Graph &graph, int p, int q);
+
+    /**
+     * @brief Limite por uma clique de G encontrada gulosamente
+     *
+     * Todos os pares de uma clique de tamanho k são adjacentes: span >= (k - 1) p.
+     *
+     * @param cliqueSize Saída opcional com o tamanho da clique encontrada
+     * @return Limite para a maior cor
+     */
+    static int cliqueBound(const Graph &graph, int p, int q, int *cliqueSize = nullptr);
+
+    /**
+     * @brief Limite por uma clique de G² (vértices dois a dois a distância <= 2)
+     *
+     * Parte da vizinhança fechada de um vértice de grau alto e a estende com
+     * vértices a distância 2. span >= (k - 1) min(p, q).
+     *
+     * @param cliqueSize Saída opcional com o tamanho da clique encontrada
+     * @return Limite para a maior cor
+     */
+    static int squareCliqueBound(const Graph &graph, int p, int q, int *cliqueSize = nullptr);
+
+    /**
+     * @brief Maior dos limites acima
+     */
+    static int compute(const Graph &graph, int p, int q);
+
+    /**
+     * @brief Gap relativo entre a solução e o limite inferior
+     * @return (maxColor - bound) / bound, ou -1 se o limite for inválido
+     */
+    static double gap(int maxColor, int bound);
+
+    /**
+     * @brief Clique gulosa de G² (usada também para quebra de simetria)
+     * @return Vértices da clique
+     */
+    static std::vector<int> findSquareClique(const Graph &graph);
+
+private:
+    // Número de vértices de maior grau usados como sementes das cliques
+    static constexpr int CLIQUE_SEEDS = 32;
+    // Orçamento de arestas visitadas na extensão da clique de G²
+    static constexpr long long SQUARE_WORK_BUDGET = 20000000LL;
+};
+
+#endif
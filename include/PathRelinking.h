@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Graph.h"
+#include "ElitePool.h"
+#include <vector>
+
+/**
+ * Religamento de caminhos entre colorações para L(p,q)-coloring.
+ *
+ * Parte de uma coloração inicial e, a cada passo, copia para um vértice a
+ * cor que ele tem na coloração guia, escolhendo o vértice que gera menos
+ * conflitos. Conflitos e maior cor das soluções intermediárias são mantidos
+ * incrementalmente (O(|N1| + |N2|) por passo), sem revalidar a coloração.
+ * Requer o índice de distância 2 do grafo.
+ */
+class PathRelinking
+{
+public:
+    PathRelinking(const Graph &g, int p, int q);
+
+    /**
+     * @brief Percorre o caminho de start até guide
+     * @return Melhor coloração viável do caminho com maior cor menor que a de
+     *         start; start, se nenhuma for melhor. Válida até a próxima chamada
+     */
+    const std::vector<int> &relink(const std::vector<int> &start, const std::vector<int> &guide);
+
+    /**
+     * @brief Religa a coloração com um membro sorteado do conjunto elite
+     * @param coloring Coloração (substituída se o caminho encontrar melhor)
+     * @param maxColor Maior cor de coloring
+     * @return Maior cor após o religamento
+     */
+    template <typename Rng>
+    int relinkWithPool(std::vector<int> &coloring, int maxColor, const ElitePool &pool, Rng &rng)
+    {
+        if (pool.empty())
+            return maxColor;
+
+        const std::vector<int> &guide = pool.member(rng.nextIndex(pool.size()));
+        const std::vector<int> &relinked = relink(coloring, guide);
+        if (lastMaxColor < maxColor)
+        {
+            coloring.assign(relinked.begin(), relinked.end());
+            return lastMaxColor;
+        }
+        return maxColor;
+    }
+
+    int getLastMaxColor() const { return lastMaxColor; }
+
+private:
+    const Graph &graph;
+    int p_param;
+    int q_param;
+    int lastMaxColor;
+
+    // Estado do caminho
+    std::vector<int> current;
+    std::vector<int> best;
+    std::vector<int> colorCount;   // vértices por cor
+    std::vector<int> diffPos;      // posição em diffList (-1 se igual à guia)
+    std::vector<int> diffList;     // vértices com cor diferente da guia
+    std::vector<int> conflictsCur; // conflitos de v com sua cor atual
+    std::vector<int> conflictsGuide; // conflitos de v se recebesse a cor da guia
+
+    int conflictsOf(int v, int c) const;
+    void shiftColor(int u, int oldColor, int newColor, const std::vector<int> &guide);
+};
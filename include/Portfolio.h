@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Graph.h"
+#include "Solver.h"
+#include <string>
+#include <vector>
+
+/**
+ * Portfólio de algoritmos: várias configurações disputam a mesma instância
+ * em paralelo, compartilhando o grafo carregado e um incumbente sem trava.
+ *
+ * A corrida termina quando todos acabam, quando alguém atinge o alvo (o
+ * limite inferior) ou quando o tempo se esgota; nos dois últimos casos os
+ * demais são cancelados e devolvem o melhor que já tinham.
+ */
+class Portfolio
+{
+public:
+    /**
+     * @brief Uma configuração do portfólio
+     */
+    struct Entry
+    {
+        std::string label; // ex.: "grasp:0.3"
+        SolverOptions options;
+    };
+
+    /**
+     * @brief Desempenho de uma configuração na corrida
+     */
+    struct EntryStats
+    {
+        bool started;  // false se a corrida acabou antes de sua vez
+        int maxColor;  // 0 se não produziu solução melhor que o incumbente
+        double seconds;
+    };
+
+    /**
+     * @brief Lê a lista "algoritmo[:alpha],..." (ex.: "greedy,grasp:0.1,reactive,tabu")
+     *
+     * As opções de cada entrada partem de base; iterações e bloco não
+     * definidos na linha de comando (0) usam o padrão de cada algoritmo.
+     * @return false (com mensagem em std::cerr) se a lista é inválida
+     */
+    static bool parse(const std::string &spec, const SolverOptions &base,
+                      int iterations, int blockSize, std::vector<Entry> &entries);
+
+    /**
+     * @brief Configurações padrão (Config::DEFAULT_PORTFOLIO)
+     */
+    static std::vector<Entry> defaults(const SolverOptions &base, int iterations, int blockSize);
+
+    Portfolio(const Graph &g, std::vector<Entry> entries);
+
+    /**
+     * @brief Base das sementes das configurações (0 = sorteada com std::rand)
+     */
+    void setBaseSeed(unsigned int seed) { baseSeed = seed; }
+
+    /**
+     * @brief Executa a corrida com até numWorkers configurações simultâneas
+     * @param target Maior cor que encerra a corrida (0 = nenhuma)
+     * @param timeLimitSeconds Tempo máximo (<= 0 = sem limite)
+     * @return Resultado da vencedora (menor maior cor; empate: primeira da lista)
+     */
+    SolverResult run(int numWorkers, int target, double timeLimitSeconds);
+
+    const std::vector<Entry> &getEntries() const { return entries; }
+    const std::vector<EntryStats> &getStats() const { return stats; }
+    int getWinner() const { return winner; }
+    bool wasTimedOut() const { return timedOut; }
+
+private:
+    const Graph &graph;
+    std::vector<Entry> entries;
+    std::vector<EntryStats> stats;
+    int winner;
+    bool timedOut;
+    unsigned int baseSeed;
+};
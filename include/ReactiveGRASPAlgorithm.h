@@ -1,7 +1,15 @@
 #pragma once
 
 #include "Graph.h"
+#include "ConstructionEngine.h"
+#include "Checkpoint.h"
+#include "SharedIncumbent.h"
+#include "WorkStealingScheduler.h"
 #include <vector>
+#include <algorithm>
+#include <string>
+
+class ElitePool;
 
 class ReactiveGRASPAlgorithm
 {
@@ -17,6 +25,75 @@ public:
     double getBestAlphaUsed() const { return bestAlphaUsed; }
     double getAverageSolution() const { return averageSolution; }
     int getBestMaxColor() const { return bestMaxColor; }
+    int getIterationsExecuted() const { return iterationsExecuted; }
+
+    /**
+     * @brief Define um limite inferior; a busca para ao atingi-lo (ótimo provado)
+     */
+    void setLowerBound(int bound) { lowerBound = bound; }
+
+    /**
+     * @brief Número de threads; com mais de uma, as iterações de cada bloco
+     * rodam em paralelo (probabilidades atualizadas só entre blocos)
+     */
+    void setNumThreads(int threads) { numThreads = std::max(1, threads); }
+
+    /**
+     * @brief Tarefas, roubos e ocupação de cada worker na última execução paralela
+     */
+    const std::vector<WorkStealingScheduler::WorkerStats> &getSchedulerStats() const { return schedulerStats; }
+
+    /**
+     * @brief Ativa o conjunto elite com religamento de caminhos (0 desativa)
+     */
+    void setEliteSize(int size) { eliteSize = size; }
+    int getRelinkImprovements() const { return relinkImprovements; }
+
+    /**
+     * @brief RCL amostrada: size > 0 vértices por passo, ou fraction de n (0 desativa)
+     */
+    void setRCLSample(int size, double fraction);
+
+    /**
+     * @brief Tamanho da amostra avaliada por passo (0 = todos os vértices)
+     */
+    int getRCLSampleSize() const;
+
+    /**
+     * @brief Solução inicial válida: incumbente, limite superior e semente do conjunto elite
+     */
+    void setInitialSolution(const std::vector<int> &coloring) { initialSolution = coloring; }
+
+    /**
+     * @brief Usa um gerador próprio com esta semente em vez de std::rand
+     * (na versão paralela, a semente-base das iterações deriva dela)
+     */
+    void setRandomSeed(unsigned int seed);
+
+    /**
+     * @brief Incumbente compartilhado: publica melhoras e para quando ele sinaliza
+     */
+    void setIncumbent(SharedIncumbent *shared) { incumbent = shared; }
+
+    /**
+     * @brief Grava checkpoints periódicos (nas fronteiras de bloco, em segundo plano)
+     * @param file Arquivo de checkpoint
+     * @param intervalSeconds Intervalo mínimo entre checkpoints
+     * @param seed Semente do gerador próprio da versão serial (sem setRandomSeed), gravada para retomar
+     */
+    void setCheckpoint(const std::string &file, double intervalSeconds, unsigned int seed);
+
+    /**
+     * @brief Carrega um checkpoint; solve() continuará dele
+     *
+     * Deve ser chamado após setNumThreads, setEliteSize, setRCLSample e
+     * setInitialSolution: modo serial/paralelo, elite, amostra da RCL, alphas e
+     * solução inicial precisam coincidir com os gravados.
+     * @return false se o arquivo não existe ou não corresponde a esta execução
+     */
+    bool resumeFrom(const std::string &file);
+
+    int getCheckpointsWritten() const { return checkpointsWritten; }
 
 private:
     const Graph &graph;
@@ -33,9 +110,33 @@ private:
     double bestAlphaUsed;
     int bestMaxColor;
     double averageSolution;
+    int iterationsExecuted;
+    int lowerBound;
+    int numThreads;
+    int eliteSize;
+    int relinkImprovements;
+    std::vector<int> initialSolution;
+    int rclSampleSize;
+    double rclSampleFraction;
+    bool hasLocalSeed;
+    unsigned int localSeed;
+    SharedIncumbent *incumbent;
+
+    std::string checkpointFile;
+    double checkpointInterval;
+    unsigned int checkpointSeed;
+    int checkpointsWritten;
+    std::vector<WorkStealingScheduler::WorkerStats> schedulerStats;
+    bool resumePending;
+    ReactiveCheckpoint resumeState;
+
+    ConstructionEngine<RCLSelection, StdRandRng, LowestIdTieBreak> engine;
 
-    std::vector<int> constructGreedyRandomized(double alpha);
-    int findSmallestValidColor(int v, const std::vector<int> &coloring);
     void updateAlphaProbabilities();
-    int selectAlphaIndex();
+    int selectAlphaIndex(double r) const;
+    std::vector<int> solveParallel();
+    ReactiveCheckpoint snapshot(int nextIteration, const std::vector<int> &bestColoring,
+                                double sumSolutions, int bestIteration, const ElitePool &pool) const;
+    void applyInitialSolution(std::vector<int> &bestColoring, ElitePool &pool);
+    void restoreState(std::vector<int> &bestColoring, double &sumSolutions, int &bestIteration, ElitePool &pool);
 };
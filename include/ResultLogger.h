@@ -9,6 +9,7 @@ class ResultLogger
 private:
     std::string filename;
     bool headerWritten;
+    bool writable; // false se um CSV antigo não pôde ser renomeado
 
     /**
      * @brief Verifica se o arquivo existe
@@ -20,6 +21,17 @@ private:
      */
     void writeHeader();
 
+    /**
+     * @brief Renomeia um CSV com cabeçalho de outra versão para não misturar colunas
+     * @return true se o arquivo foi movido (ou não precisava ser)
+     */
+    bool rotateIfStale();
+
+    /**
+     * @brief Linha de cabeçalho das colunas atuais (sem quebra de linha)
+     */
+    static const std::string &header();
+
 public:
     /**
      * @brief Construtor
@@ -31,7 +43,7 @@ public:
      * @brief Registra um resultado de execução
      *
      * @param instance Nome da instância
-     * @param algorithm Nome do algoritmo executado
+     * @param algorithm Nome do algoritmo executado ("portfolio/<vencedor>" no portfólio)
      * @param p Parâmetro p do L(p,q)-coloring
      * @param q Parâmetro q do L(p,q)-coloring
      * @param alpha Parâmetro alpha (para GRASP)
@@ -42,6 +54,8 @@ public:
      * @param bestSolution Valor da melhor solução (maior cor)
      * @param bestAlpha Alpha que forneceu melhor solução (para reativo)
      * @param averageSolution Média das soluções nas iterações
+     * @param lowerBound Limite inferior da maior cor (gap é derivado dele)
+     * @param rclSample Vértices avaliados por passo na RCL amostrada (0 = todos)
      * @return true se o registro foi bem-sucedido, false caso contrário
      */
     bool logResult(const std::string &instance,
@@ -54,7 +68,9 @@ public:
                    double executionTime,
                    int bestSolution,
                    double bestAlpha = -1.0,
-                   double averageSolution = -1.0);
+                   double averageSolution = -1.0,
+                   int lowerBound = -1,
+                   int rclSample = 0);
 
     /**
      * @brief Obtém timestamp atual formatado
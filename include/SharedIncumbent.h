@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+
+/**
+ * Incumbente compartilhado entre solvers concorrentes (portfólio).
+ *
+ * Guarda a menor maior cor já encontrada e um sinal de cancelamento, ambos
+ * atômicos e sem trava. Os solvers publicam suas melhoras, consultam
+ * getBestSpan() para descartar trabalho que não pode melhorar o incumbente
+ * e param quando shouldStop() indica alvo atingido, cancelamento ou fim do
+ * tempo.
+ */
+class SharedIncumbent
+{
+public:
+    /**
+     * @param target Maior cor que encerra a corrida (ex.: limite inferior; 0 = nenhuma)
+     * @param timeLimitSeconds Tempo máximo a partir da construção (<= 0 = sem limite)
+     */
+    SharedIncumbent(int target, double timeLimitSeconds)
+        : bestSpan(INT_MAX), cancelled(false), target(target), hasDeadline(timeLimitSeconds > 0.0)
+    {
+        deadline = std::chrono::steady_clock::now() +
+                   std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                       std::chrono::duration<double>(hasDeadline ? timeLimitSeconds : 0.0));
+    }
+
+    int getBestSpan() const { return bestSpan.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Registra uma solução viável com a maior cor span
+     * @return true se melhorou o incumbente
+     */
+    bool publish(int span)
+    {
+        int current = bestSpan.load(std::memory_order_relaxed);
+        while (span < current)
+        {
+            if (bestSpan.compare_exchange_weak(current, span, std::memory_order_relaxed))
+            {
+                if (target > 0 && span <= target)
+                    cancel();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void cancel() { cancelled.store(true, std::memory_order_release); }
+    bool isCancelled() const { return cancelled.load(std::memory_order_acquire); }
+
+    bool timedOut() const { return hasDeadline && std::chrono::steady_clock::now() >= deadline; }
+
+    /**
+     * @brief Verdadeiro se os solvers devem parar e devolver o melhor que têm
+     */
+    bool shouldStop() const { return isCancelled() || timedOut(); }
+
+private:
+    std::atomic<int> bestSpan;
+    std::atomic<bool> cancelled;
+    int target;
+    bool hasDeadline;
+    std::chrono::steady_clock::time_point deadline;
+};
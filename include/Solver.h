@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Graph.h"
+#include "Config.h"
+#include "SharedIncumbent.h"
+#include <string>
+#include <vector>
+
+/**
+ * Opções de execução de um algoritmo (espelham a linha de comando).
+ */
+struct SolverOptions
+{
+    std::string algorithm = Config::ALGORITHM_GREEDY;
+    int p = Config::DEFAULT_P;
+    int q = Config::DEFAULT_Q;
+    double alpha = Config::DEFAULT_ALPHA;
+    int iterations = Config::DEFAULT_ITERATIONS;
+    int blockSize = Config::DEFAULT_BLOCK_SIZE_GRASPR;
+    int eliteSize = Config::DEFAULT_ELITE_SIZE;
+    int numThreads = Config::DEFAULT_THREADS;
+    int rclSampleCount = 0;         // tamanho absoluto da amostra da RCL
+    double rclSampleFraction = 0.0; // ou fração de n
+    std::string tabuInit = Config::ALGORITHM_GREEDY;
+
+    // Ordem do guloso (vazia = grau decrescente); se definida, o guloso nessa
+    // ordem também é a solução inicial do GRASP, do GRASP reativo e do exato
+    std::string order;
+    int lowerBound = 0;
+
+    // Solução inicial válida (vazia = nenhuma) e sua origem, para as mensagens
+    std::vector<int> initialColoring;
+    std::string initialLabel;
+
+    // Checkpoint do GRASP reativo (arquivo vazio = desativado)
+    std::string checkpointFile;
+    double checkpointInterval = Config::DEFAULT_CHECKPOINT_INTERVAL;
+    unsigned int checkpointSeed = 0;
+    bool resume = false;
+
+    // Branch-and-bound exato: limites de nós (0 = sem limite) e de tempo em segundos (0 = sem limite)
+    long long nodeLimit = Config::DEFAULT_EXACT_NODE_LIMIT;
+    double timeLimit = Config::DEFAULT_TIME_LIMIT;
+
+    // Guloso sobre vizinhanças compactas: bits de id/cor (-1 = int do Graph, 0 = automático)
+    int compactWidth = -1;
+
+    // Semente de um gerador próprio (0 = sequência global de std::rand)
+    unsigned int randomSeed = 0;
+
+    // Incumbente compartilhado com outros solvers (portfólio; nulo = nenhum)
+    SharedIncumbent *incumbent = nullptr;
+
+    // Imprime as mensagens [INFO] em std::cout
+    bool verbose = true;
+};
+
+/**
+ * Resultado de Solver::run.
+ */
+struct SolverResult
+{
+    std::vector<int> coloring;
+    double bestAlphaUsed = -1.0;   // só GRASP reativo
+    double averageSolution = -1.0; // só GRASP e GRASP reativo
+    int rclSampleSize = 0;
+    int provenBound = 0;           // só branch-and-bound: limite inferior provado (0 = nenhum)
+    bool ok = true;                // false se o checkpoint não pôde ser retomado
+};
+
+/**
+ * Despacha a execução para o algoritmo escolhido.
+ */
+class Solver
+{
+public:
+    /**
+     * @brief Executa options.algorithm sobre o grafo (índice de distância 2 já construído)
+     */
+    static SolverResult run(const Graph &graph, const SolverOptions &options);
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "GraphCache.h"
+#include "JsonLine.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Servidor de longa duração (subcomando "serve").
+ *
+ * Recebe requisições de resolução em JSON, uma por linha, por um socket Unix
+ * ou pela entrada padrão, e responde uma linha JSON por requisição (na ordem
+ * de término, identificada pelo campo "id"). Os grafos ficam em um
+ * GraphCache e as requisições são resolvidas em paralelo por um conjunto
+ * fixo de workers.
+ *
+ * Requisição: {"id":1,"graph":"arquivo","p":2,"q":1,"algorithm":"grasp",
+ *   "alpha":0.3,"iterations":100,"block":10,"elite":0,"rcl_sample":0,
+ *   "tabu_init":"greedy","threads":1,"seed":5,"portfolio":"...",
+ *   "time_limit":0,"coloring":false,"validate":false}
+ * Comandos: {"command":"stats"} e {"command":"shutdown"}.
+ */
+class SolverDaemon
+{
+public:
+    SolverDaemon(size_t cacheCapacity, int numWorkers);
+    ~SolverDaemon();
+
+    SolverDaemon(const SolverDaemon &) = delete;
+    SolverDaemon &operator=(const SolverDaemon &) = delete;
+
+    /**
+     * @brief Atende requisições lidas de inFd e responde em outFd até EOF ou "shutdown"
+     */
+    int serveStream(int inFd, int outFd);
+
+    /**
+     * @brief Atende conexões no socket Unix em path até "shutdown"
+     */
+    int serveSocket(const std::string &path);
+
+    /**
+     * @brief Subcomando "serve" da linha de comando
+     * @return Código de saída do processo
+     */
+    static int runCommand(int argc, char *argv[]);
+
+private:
+    // Uma conexão (ou o par entrada/saída padrão); escritas são atômicas por linha
+    struct Connection
+    {
+        int inFd;
+        int outFd;
+        bool ownsFd;
+        std::mutex writeMutex;
+
+        Connection(int in, int out, bool owns) : inFd(in), outFd(out), ownsFd(owns) {}
+        ~Connection();
+        void send(const std::string &line);
+    };
+
+    struct Job
+    {
+        std::shared_ptr<Connection> connection;
+        std::map<std::string, JsonLine::Value> fields;
+        std::chrono::steady_clock::time_point received;
+    };
+
+    GraphCache cache;
+    std::vector<std::thread> workers;
+
+    std::mutex queueMutex;
+    std::condition_variable queueReady;
+    std::deque<Job> queue;
+    bool draining; // workers saem quando a fila esvazia
+
+    std::atomic<bool> shutdownRequested;
+    std::atomic<unsigned long long> served;
+    std::atomic<unsigned long long> failed;
+    std::atomic<unsigned int> seedCounter;
+
+    std::mutex connectionsMutex;
+    std::vector<std::weak_ptr<Connection>> connections;
+    std::atomic<int> listenFd;
+
+    void readLoop(const std::shared_ptr<Connection> &connection);
+    void handleLine(const std::shared_ptr<Connection> &connection, const std::string &line);
+    void workerLoop();
+    std::string solve(const std::map<std::string, JsonLine::Value> &fields, double queueSeconds);
+    std::string statsLine(const std::string &id);
+    void requestShutdown();
+    void stopWorkers();
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Graph.h"
+#include "ConstructionEngine.h"
+#include "SharedIncumbent.h"
+#include <vector>
+
+/**
+ * Busca tabu (estilo TabuCol) para L(p,q)-coloring com span fixo.
+ *
+ * Fixado k, minimiza o número de pares que violam as restrições de
+ * separação em N1 (|c(u) - c(v)| >= p) e N2 (|c(u) - c(v)| >= q). Cada vez
+ * que encontra uma coloração viável, reduz k em uma unidade e continua.
+ */
+class TabuSearchAlgorithm
+{
+public:
+    TabuSearchAlgorithm(const Graph &g, int p, int q, int maxIterationsPerSpan);
+
+    /**
+     * @brief Executa a busca a partir de uma coloração viável
+     * @param initial Coloração inicial (ex.: resultado do guloso ou GRASP)
+     * @return Melhor coloração viável encontrada
+     */
+    std::vector<int> solve(const std::vector<int> &initial);
+
+    /**
+     * @brief Define um limite inferior; a busca para ao atingi-lo
+     */
+    void setLowerBound(int bound) { lowerBound = bound; }
+
+    /**
+     * @brief Usa um gerador próprio com esta semente em vez de std::rand
+     */
+    void setRandomSeed(unsigned int seed) { rng.seedLocal(seed); }
+
+    /**
+     * @brief Incumbente compartilhado: publica cada span viável, passa direto
+     * a spans abaixo do incumbente e para quando ele sinaliza
+     */
+    void setIncumbent(SharedIncumbent *shared) { incumbent = shared; }
+
+    long long getTotalIterations() const { return totalIterations; }
+
+private:
+    const Graph &graph;
+    int p_param;
+    int q_param;
+    int maxIterationsPerSpan;
+    int lowerBound;
+    long long totalIterations;
+    StdRandRng rng;
+    SharedIncumbent *incumbent;
+
+    // Vizinhança a distância 1 sem repetições (a distância 2 vem do índice do grafo)
+    std::vector<std::vector<int>> n1;
+
+    // Estado da busca para o span atual
+    int span;
+    std::vector<int> coloring;
+    std::vector<int> gamma;          // gamma[v * (span + 1) + c]: conflitos de v se tivesse cor c
+    std::vector<long long> tabuUntil; // mesmo layout de gamma
+    std::vector<int> conflicting;    // vértices com conflito na cor atual
+    std::vector<int> conflictPos;    // posição em conflicting (-1 se ausente)
+    long long totalConflicts;
+
+    int &gammaAt(int v, int c) { return gamma[static_cast<size_t>(v) * (span + 1) + c]; }
+
+    void buildNeighborhoods();
+    void resetSpan(int k);
+    void placeColor(int v, int c, int sign);
+    void updateConflictMembership(int v);
+    void moveVertex(int v, int newColor);
+    bool runTabu(long long &iterationCounter);
+};
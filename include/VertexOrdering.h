@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Graph.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * Ordens de vértices para o guloso de ordem fixa (--order).
+ *
+ * - degree: grau decrescente em G, desempate pelo menor id (a ordem padrão)
+ * - sl:     smallest-last sobre G² (grau = |N1| + |N2|), a ordem de degenerescência
+ * - random: permutação uniforme
+ * - bfs:    busca em largura em G a partir do vértice de maior grau de cada componente
+ */
+class VertexOrdering
+{
+public:
+    /**
+     * @brief true se name é uma das ordens acima
+     */
+    static bool isValid(const std::string &name);
+
+    /**
+     * @brief Ordem pelo nome
+     * @param seed Semente da ordem aleatória
+     * @param degeneracy Saída opcional: degenerescência de G² (só sl; -1 nas demais)
+     */
+    static std::vector<int> compute(const Graph &graph, const std::string &name, unsigned int seed,
+                                    int *degeneracy = nullptr);
+
+    /**
+     * @brief Ordena vertices por grau decrescente em G, desempate pela menor chave
+     *
+     * O comparador único das ordens por grau (guloso, limite inferior,
+     * reparos); key(v) é o id por padrão.
+     */
+    template <typename Key>
+    static void sortByDegree(const Graph &graph, std::vector<int> &vertices, Key key)
+    {
+        std::sort(vertices.begin(), vertices.end(), [&graph, &key](int a, int b)
+                  {
+            int da = graph.getDegree(a);
+            int db = graph.getDegree(b);
+            if (da != db)
+                return da > db;
+            return key(a) < key(b); });
+    }
+
+    static void sortByDegree(const Graph &graph, std::vector<int> &vertices)
+    {
+        sortByDegree(graph, vertices, [](int v)
+                     { return v; });
+    }
+
+    /**
+     * @brief Todos os vértices por grau decrescente, menor id no empate
+     */
+    static std::vector<int> byDegree(const Graph &graph);
+
+    /**
+     * @brief Smallest-last sobre G² em tempo linear (filas por balde de grau)
+     *
+     * Remove repetidamente um vértice de menor grau no G² restante e colore
+     * na ordem inversa da remoção: cada vértice tem no máximo k vizinhos em G²
+     * já coloridos, onde k é a degenerescência. N2 vem do índice do grafo, do
+     * índice comprimido ou, sem nenhum dos dois, da cache sob demanda.
+     *
+     * @param degeneracy Saída opcional: maior grau mínimo visto nas remoções
+     */
+    static std::vector<int> smallestLast(const Graph &graph, int *degeneracy = nullptr);
+
+    static std::vector<int> randomOrder(const Graph &graph, unsigned int seed);
+
+    static std::vector<int> breadthFirst(const Graph &graph);
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Graph.h"
+#include <vector>
+
+/**
+ * Redução por remoção de vértices de baixo grau restritivo.
+ *
+ * Um vértice v proíbe no máximo 2p - 1 cores por vizinho em N1 e 2q - 1 por
+ * vizinho em N2. Se essa soma, contada só sobre os vértices ainda presentes,
+ * for menor que o número de cores disponíveis k, v sempre encontra uma cor
+ * em 1..k qualquer que seja a coloração dos demais. Tais vértices são
+ * removidos repetidamente; o núcleo restante é resolvido e os removidos são
+ * reinseridos gulosamente na ordem inversa da remoção.
+ *
+ * Com k igual a um limite inferior da maior cor, a maior cor final é o
+ * máximo entre a do núcleo e k, logo a redução não piora o ótimo.
+ */
+class VertexPeeling
+{
+public:
+    VertexPeeling(const Graph &g, int p, int q);
+
+    /**
+     * @brief Remove iterativamente os vértices sempre coloríveis com colors cores
+     * @return Número de vértices removidos
+     */
+    int peel(int colors);
+
+    int getNumPeeled() const { return static_cast<int>(peeled.size()); }
+    int getKernelSize() const { return static_cast<int>(kernelVertices.size()); }
+
+    /**
+     * @brief Vértices do núcleo em ordem crescente (vértice local i = kernelVertices[i])
+     */
+    const std::vector<int> &getKernelVertices() const { return kernelVertices; }
+
+    /**
+     * @brief Subgrafo induzido pelo núcleo
+     *
+     * O índice de distância 2 é o do grafo original restrito ao núcleo:
+     * pares ligados só por vértices removidos continuam restritos.
+     */
+    Graph buildKernel() const;
+
+    /**
+     * @brief Restringe uma coloração do grafo original ao núcleo
+     */
+    std::vector<int> toKernel(const std::vector<int> &coloring) const;
+
+    /**
+     * @brief Estende a coloração do núcleo, reinserindo os removidos do último ao primeiro
+     * @return Coloração do grafo original
+     */
+    std::vector<int> restore(const std::vector<int> &kernelColoring) const;
+
+private:
+    const Graph &graph;
+    int p_param;
+    int q_param;
+    std::vector<int> peeled;         // ordem de remoção
+    std::vector<int> kernelVertices;
+    std::vector<int> localIndex;     // posição no núcleo (-1 se removido)
+};
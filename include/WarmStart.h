@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Graph.h"
+#include <string>
+#include <vector>
+
+/**
+ * Partida a quente a partir de uma solução salva por OutputWriter::writeSolution.
+ */
+class WarmStart
+{
+public:
+    /**
+     * @brief Lê a solução no formato "vértice cor" (linhas com # são ignoradas)
+     * @param filename Arquivo da solução
+     * @param numVertices Número de vértices do grafo atual
+     * @param coloring Coloração lida (0 para vértices ausentes ou inválidos)
+     * @return true se o arquivo foi lido
+     */
+    static bool readSolution(const std::string &filename, int numVertices, std::vector<int> &coloring);
+
+    /**
+     * @brief Torna a coloração válida alterando o mínimo de vértices
+     *
+     * Percorre os vértices em ordem e mantém a cor de cada um se ela respeita
+     * as separações com os vértices já mantidos; os demais (e os sem cor)
+     * recebem gulosamente a menor cor válida, em ordem de grau decrescente.
+     *
+     * @return Número de vértices recoloridos
+     */
+    static int repair(const Graph &graph, int p, int q, std::vector<int> &coloring);
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+/**
+ * Escalonador de tarefas com roubo de trabalho.
+ *
+ * Cada worker tem sua própria deque: executa as tarefas do fim da sua
+ * (LIFO, mais quente na cache) e, quando ela esvazia, rouba a metade mais
+ * antiga da deque de outro worker. Tarefas de custo muito desigual
+ * (iterações do GRASP, componentes, instâncias de um lote) ficam
+ * balanceadas sem partição estática.
+ *
+ * As tarefas recebem o índice do worker que as executa, para usar
+ * estruturas por worker (motores de construção, buffers) sem trava.
+ */
+class WorkStealingScheduler
+{
+public:
+    using Task = std::function<void(int worker)>;
+
+    /**
+     * @brief Contadores de um worker desde a criação (ou resetStats)
+     */
+    struct WorkerStats
+    {
+        long long tasks = 0;       // tarefas executadas
+        long long steals = 0;      // roubos bem-sucedidos
+        long long stolenTasks = 0; // tarefas obtidas por roubo
+        double busySeconds = 0.0;  // tempo executando tarefas
+        double utilization = 0.0;  // busySeconds / tempo decorrido
+    };
+
+    /**
+     * @param numWorkers Número de threads (>= 1)
+     */
+    explicit WorkStealingScheduler(int numWorkers);
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+    WorkStealingScheduler &operator=(const WorkStealingScheduler &) = delete;
+
+    int getNumWorkers() const { return static_cast<int>(workers.size()); }
+
+    /**
+     * @brief Enfileira uma tarefa (distribuição circular entre as deques)
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Enfileira na deque de um worker (ex.: subtarefa criada por uma tarefa)
+     */
+    void submitTo(int worker, Task task);
+
+    /**
+     * @brief Bloqueia até que todas as tarefas enviadas terminem
+     */
+    void wait();
+
+    /**
+     * @brief Executa body(i, worker) para i em [begin, end) e espera o fim
+     *
+     * Os índices são agrupados em tarefas de grain elementos, distribuídas
+     * em ordem circular; o roubo reequilibra o restante.
+     */
+    template <typename Body>
+    void parallelFor(int begin, int end, Body body, int grain = 1)
+    {
+        grain = grain > 0 ? grain : 1;
+        for (int start = begin; start < end; start += grain)
+        {
+            int stop = start + grain < end ? start + grain : end;
+            submit([body, start, stop](int worker)
+                   {
+                for (int i = start; i < stop; ++i)
+                    body(i, worker); });
+        }
+        wait();
+    }
+
+    /**
+     * @brief Estatísticas por worker (chamar com o escalonador ocioso)
+     */
+    std::vector<WorkerStats> getStats() const;
+
+    void resetStats();
+
+    /**
+     * @brief Imprime uma linha por worker com tarefas, roubos e ocupação
+     */
+    static void printStats(const std::vector<WorkerStats> &stats, std::ostream &out, const char *indent = "  ");
+
+private:
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        WorkerStats stats;
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Tarefas nas deques (para acordar workers ociosos) e ainda não concluídas
+    std::mutex idleMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    long long queued;
+    long long unfinished;
+    bool stopping;
+
+    std::atomic<unsigned> nextDeque;
+    std::chrono::steady_clock::time_point statsStart;
+
+    void run(int self);
+    bool popOwn(int self, Task &task);
+    bool steal(int self, Task &task);
+    void push(int worker, Task task);
+};
@@ -33,8 +33,209 @@ run_test() {
     echo
 }
 
+# Como run_test, mas exige também a validação da coloração final na saída
+# (uma coloração inválida não muda o código de saída)
+run_valid() {
+    local name=$1
+    local instance=$2
+    local args=$3
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+    echo "  Instância: $instance"
+
+    local output
+    if output=$(./bin/lpq_coloring -i "$instance" $args 2> /dev/null) &&
+       echo "$output" | grep -q "Coloração válida"; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    echo
+}
+
+# Partida a quente: resolve com -o, opcionalmente estraga o arquivo (remove
+# as linhas dos vértices 10-19 e acrescenta linhas inválidas) e resolve de
+# novo com --init; a coloração final deve ser válida, com maior cor não
+# acima da inicial, e o reparo só pode ocorrer no arquivo estragado
+run_warm_start() {
+    local name=$1
+    local instance=$2
+    local args=$3
+    local damage=$4
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+    echo "  Instância: $instance"
+
+    local init output initial final repaired
+    init=$(mktemp)
+    ./bin/lpq_coloring -i "$instance" $args -o "$init" > /dev/null 2>&1
+    if [ "$damage" = "1" ]; then
+        sed -i '/^1[0-9] /d' "$init"
+        printf 'x y
+999999 3
+7 0
+-1 4
+' >> "$init"
+    fi
+    output=$(./bin/lpq_coloring -i "$instance" $args --init "$init" 2> /dev/null)
+    initial=$(echo "$output" | sed -n 's/.*Solução inicial: .*(maior cor \([0-9]*\), \([0-9]*\) vértices.*/\1/p')
+    repaired=$(echo "$output" | sed -n 's/.*Solução inicial: .*(maior cor \([0-9]*\), \([0-9]*\) vértices.*/\2/p')
+    final=$(echo "$output" | sed -n 's/^Maior cor utilizada: \([0-9]*\)$/\1/p' | tail -1)
+    local repair_ok=0
+    if [ "$damage" = "1" ]; then
+        [ -n "$repaired" ] && [ "$repaired" -gt 0 ] && repair_ok=1
+    else
+        [ "$repaired" = "0" ] && repair_ok=1
+    fi
+    if echo "$output" | grep -q "Coloração válida" && [ -n "$initial" ] && [ -n "$final" ] &&
+       [ "$final" -le "$initial" ] && [ "$repair_ok" = "1" ]; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    rm -f "$init"
+    echo
+}
+
+# Executa a mesma instância com dois conjuntos de argumentos e compara as
+# soluções gravadas (devem ser idênticas)
+run_compare() {
+    local name=$1
+    local instance=$2
+    local args_a=$3
+    local args_b=$4
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+    echo "  Instância: $instance"
+
+    local out_a out_b
+    out_a=$(mktemp)
+    out_b=$(mktemp)
+    if ./bin/lpq_coloring -i "$instance" $args_a -o "$out_a" > /dev/null 2>&1 &&
+       ./bin/lpq_coloring -i "$instance" $args_b -o "$out_b" > /dev/null 2>&1 &&
+       cmp -s "$out_a" "$out_b"; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    rm -f "$out_a" "$out_b"
+    echo
+}
+
+# Resolve duas instâncias com os mesmos argumentos e compara as soluções
+run_compare_instances() {
+    local name=$1
+    local instance_a=$2
+    local instance_b=$3
+    local args=$4
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+
+    local out_a out_b
+    out_a=$(mktemp)
+    out_b=$(mktemp)
+    if ./bin/lpq_coloring -i "$instance_a" $args -o "$out_a" > /dev/null 2>&1 &&
+       ./bin/lpq_coloring -i "$instance_b" $args -o "$out_b" > /dev/null 2>&1 &&
+       cmp -s "$out_a" "$out_b"; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    rm -f "$out_a" "$out_b"
+    echo
+}
+
+# Interrompe (SIGKILL) uma execução com --checkpoint após o primeiro
+# checkpoint, retoma com --resume e compara com uma execução sem interrupção
+run_resume() {
+    local name=$1
+    local instance=$2
+    local args=$3
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+    echo "  Instância: $instance"
+
+    local dir pid
+    dir=$(mktemp -d)
+    ./bin/lpq_coloring -i "$instance" $args --checkpoint "$dir/continua.ckpt" -o "$dir/continua.txt" > /dev/null 2>&1
+    ./bin/lpq_coloring -i "$instance" $args --checkpoint "$dir/retomada.ckpt" --checkpoint-every 0 \
+        -o "$dir/retomada.txt" > /dev/null 2>&1 &
+    pid=$!
+    for _ in $(seq 200); do
+        [ -f "$dir/retomada.ckpt" ] && break
+        sleep 0.05
+    done
+    kill -9 "$pid" 2> /dev/null
+    wait "$pid" 2> /dev/null
+    if [ -f "$dir/retomada.ckpt" ] &&
+       ./bin/lpq_coloring -i "$instance" $args --checkpoint "$dir/retomada.ckpt" --resume \
+           -o "$dir/retomada.txt" > /dev/null 2>&1 &&
+       cmp -s "$dir/continua.txt" "$dir/retomada.txt"; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    rm -rf "$dir"
+    echo
+}
+
+# Envia requisições JSON ao servidor pela entrada padrão; a saída deve ter
+# uma resposta por requisição, todas com "ok":true
+run_serve() {
+    local name=$1
+    local requests=$2
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+
+    local expected responses
+    expected=$(printf "$requests" | wc -l)
+    responses=$(printf "$requests" | ./bin/lpq_coloring serve --workers 2 2> /dev/null)
+    if [ "$(echo "$responses" | grep -c '"ok":true')" -eq "$expected" ]; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    echo
+}
+
+# Executa um comando qualquer; passa se o código de saída for 0
+run_command() {
+    local name=$1
+    shift
+
+    TOTAL=$((TOTAL + 1))
+    echo "Teste $TOTAL: $name"
+
+    if "$@" > /dev/null 2>&1; then
+        echo -e "  ${GREEN}✓ PASSOU${NC}"
+        PASSED=$((PASSED + 1))
+    else
+        echo -e "  ${RED}✗ FALHOU${NC}"
+        FAILED=$((FAILED + 1))
+    fi
+    echo
+}
+
 echo "Compilando projeto..."
-if make > /dev/null 2>&1; then
+if make > /dev/null 2>&1 && make bin/kernel_check > /dev/null 2>&1; then
     echo -e "${GREEN}✓ Compilação bem-sucedida${NC}"
 else
     echo -e "${RED}✗ Falha na compilação${NC}"
@@ -51,6 +252,56 @@ run_test "Grafo médio - flat300_28_0" "instances/dimacs/flat300_28_0.col" 2 1 "
 run_test "Grafo Leighton - le450_15c" "instances/dimacs/le450_15c.col" 2 1 ""
 run_test "Parâmetros diferentes (p=3, q=2)" "instances/dimacs/dsjc125.1.col" 3 2 ""
 run_test "Com seed customizada" "instances/dimacs/dsjc125.1.col" 2 1 "-s 123456"
+run_test "Busca tabu" "instances/dimacs/r125.1.col" 2 1 "-a tabu --iter 2000"
+run_test "Redução de vértices (--peel)" "instances/dimacs/school1.col" 2 1 "-a grasp --iter 10 --peel"
+run_test "Guloso por saturação (dsatur)" "instances/dimacs/le450_15c.col" 3 2 "-a dsatur"
+run_test "Guloso em ordem smallest-last de G²" "instances/dimacs/le450_15c.col" 2 1 "--order sl"
+run_test "Branch-and-bound exato" "instances/dimacs/r125.1.col" 2 1 "-a exact"
+run_test "Portfólio com tempo máximo" "instances/dimacs/dsjc125.1.col" 2 1 "-a portfolio --time-limit 2 --threads 2"
+run_valid "Alterações dinâmicas (--changes): arestas, vértices e lotes" "instances/dimacs/dsjc125.1.col" \
+    "--changes tests/alteracoes_dsjc125.1.txt"
+run_warm_start "Partida a quente (--init): solução de -o" "instances/dimacs/dsjc125.1.col" \
+    "-a grasp --iter 10 -s 3" 0
+run_warm_start "Partida a quente (--init): linhas ausentes e inválidas reparadas" "instances/dimacs/dsjc125.1.col" \
+    "-a grasp --iter 10 -s 3" 1
+run_serve "Servidor (serve) com cache de grafos" \
+    '{"id":1,"graph":"instances/dimacs/dsjc125.1.col","algorithm":"grasp","seed":5,"validate":true}\n{"id":2,"graph":"instances/dimacs/dsjc125.1.col","p":3,"q":2,"seed":6,"coloring":true}\n{"id":3,"command":"stats"}\n'
+run_command "Kernels AVX2/SSE2 = escalar (violationJump e smallestClearing, fatias aleatórias)" \
+    ./bin/kernel_check 50000
+run_compare "Kernel vetorial = escalar (GRASP)" "instances/dimacs/dsjc125.1.col" \
+    "-a grasp -s 42 --kernel scalar" "-a grasp -s 42 --kernel auto"
+run_compare "Kernel vetorial = escalar (p=3, q=2)" "instances/dimacs/le450_15c.col" \
+    "-p 3 -q 2 --kernel scalar" "-p 3 -q 2 --kernel auto"
+run_compare "Ids/cores de 16 bits = int (guloso)" "instances/dimacs/school1.col" \
+    "-p 3 -q 2 --width int" "-p 3 -q 2 --width 16"
+run_compare "Ids/cores de 16 bits = int (guloso em ordem smallest-last)" "instances/dimacs/school1.col" \
+    "-p 3 -q 2 --order sl" "-p 3 -q 2 --order sl --width 16"
+run_compare "N2 sob demanda (--n2-cache) = índice (GRASP)" "instances/dimacs/dsjc125.1.col" \
+    "-a grasp -s 5" "-a grasp -s 5 --n2-cache 0.02"
+run_compare "Smallest-last: N2 sob demanda (--n2-cache 0) = índice" "instances/dimacs/le450_15c.col" \
+    "--order sl" "--order sl --n2-cache 0"
+run_compare "Índice comprimido (--n2-compressed) = listas (p=3, q=2)" "instances/dimacs/le450_15c.col" \
+    "-p 3 -q 2" "-p 3 -q 2 --n2-compressed"
+run_compare "GRASP paralelo: 2 threads = 4 threads" "instances/dimacs/dsjc125.1.col" \
+    "-a grasp -s 9 --threads 2" "-a grasp -s 9 --threads 4"
+run_resume "Checkpoint: interrompida e retomada = contínua (serial)" "instances/dimacs/dsjc125.1.col" \
+    "-a reactive --iter 600 -s 8"
+run_resume "Checkpoint: interrompida e retomada = contínua (3 threads)" "instances/dimacs/dsjc125.1.col" \
+    "-a reactive --iter 600 -s 8 --threads 3"
+
+GEN_DIR=$(mktemp -d)
+./bin/lpq_coloring generate geometric --n 3000 --radius 0.03 -s 7 -o "$GEN_DIR/geo.col" > /dev/null 2>&1
+./bin/lpq_coloring generate geometric --n 3000 --radius 0.03 -s 7 --format binary -o "$GEN_DIR/geo.bin" > /dev/null 2>&1
+run_compare_instances "Gerador: DIMACS = binário" "$GEN_DIR/geo.col" "$GEN_DIR/geo.bin" "-s 1"
+./bin/lpq_coloring generate geometric --n 2000 --radius 0.02 -s 7 -o "$GEN_DIR/geo_sparse.col" > /dev/null 2>&1
+run_compare "Componentes: 1 thread = 4 threads" "$GEN_DIR/geo_sparse.col" \
+    "-a reactive --iter 60 -s 9 --components --threads 1" "-a reactive --iter 60 -s 9 --components --threads 4"
+printf '%s\n' instances/dimacs/dsjc125.1.col instances/dimacs/r125.5.col "$GEN_DIR/geo.bin" > "$GEN_DIR/lista.txt"
+run_command "Lote em pipeline (batch)" ./bin/lpq_coloring batch "$GEN_DIR/lista.txt" \
+    -a grasp --iter 10 -s 3 --out-dir "$GEN_DIR"
+run_command "Lote com resolução em paralelo (batch --jobs)" ./bin/lpq_coloring batch "$GEN_DIR/lista.txt" \
+    -a grasp --iter 10 -s 3 --jobs 2
+rm -rf "$GEN_DIR"
 
 echo "========================================="
 echo "  Resumo dos Testes"
@@ -0,0 +1,58 @@
+#include "../include/AllocationCounter.h"
+
+#ifdef LPQ_COUNT_ALLOCATIONS
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<unsigned long long> allocationCount(0);
+    std::atomic<unsigned long long> allocationBytes(0);
+
+    // Mesmo contrato do operator new padrão: tenta de novo enquanto houver
+    // new_handler instalado, e só então lança bad_alloc
+    void *countedAlloc(std::size_t size)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocationBytes.fetch_add(size, std::memory_order_relaxed);
+        for (;;)
+        {
+            void *ptr = std::malloc(size == 0 ? 1 : size);
+            if (ptr)
+                return ptr;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+}
+
+bool AllocationCounter::enabled() { return true; }
+
+unsigned long long AllocationCounter::count()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+unsigned long long AllocationCounter::bytes()
+{
+    return allocationBytes.load(std::memory_order_relaxed);
+}
+
+void *operator new(std::size_t size) { return countedAlloc(size); }
+void *operator new[](std::size_t size) { return countedAlloc(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+#else
+
+bool AllocationCounter::enabled() { return false; }
+unsigned long long AllocationCounter::count() { return 0; }
+unsigned long long AllocationCounter::bytes() { return 0; }
+
+#endif
@@ -0,0 +1,117 @@
+#include "../include/Arena.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+    constexpr size_t MIN_BLOCK_BYTES = 4096;
+}
+
+Arena::Arena(size_t initialBytes)
+    : offset(0), usedBefore(0), blocksAllocated(0)
+{
+    if (initialBytes > 0)
+        addBlock(initialBytes);
+}
+
+Arena::~Arena()
+{
+    releaseAll();
+}
+
+Arena::Arena(Arena &&other) noexcept
+    : blocks(std::move(other.blocks)),
+      offset(other.offset),
+      usedBefore(other.usedBefore),
+      blocksAllocated(other.blocksAllocated)
+{
+    other.blocks.clear();
+    other.offset = 0;
+    other.usedBefore = 0;
+}
+
+Arena &Arena::operator=(Arena &&other) noexcept
+{
+    if (this != &other)
+    {
+        releaseAll();
+        blocks = std::move(other.blocks);
+        offset = other.offset;
+        usedBefore = other.usedBefore;
+        blocksAllocated = other.blocksAllocated;
+        other.blocks.clear();
+        other.offset = 0;
+        other.usedBefore = 0;
+    }
+    return *this;
+}
+
+void Arena::addBlock(size_t minBytes)
+{
+    size_t size = std::max(minBytes, MIN_BLOCK_BYTES);
+    if (!blocks.empty())
+    {
+        usedBefore += offset;
+        size = std::max(size, blocks.back().size * 2);
+    }
+    blocks.push_back({new char[size], size});
+    offset = 0;
+    ++blocksAllocated;
+}
+
+void Arena::releaseAll()
+{
+    for (Block &b : blocks)
+        delete[] b.data;
+    blocks.clear();
+    offset = 0;
+    usedBefore = 0;
+}
+
+void *Arena::allocate(size_t bytes, size_t alignment)
+{
+    if (!blocks.empty())
+    {
+        Block &b = blocks.back();
+        uintptr_t base = reinterpret_cast<uintptr_t>(b.data);
+        size_t aligned = ((base + offset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+        if (aligned + bytes <= b.size)
+        {
+            offset = aligned + bytes;
+            return b.data + aligned;
+        }
+    }
+
+    // Bloco novo (alinhado a max_align_t pelo new[]), com folga para o alinhamento
+    addBlock(bytes + alignment);
+    Block &b = blocks.back();
+    uintptr_t base = reinterpret_cast<uintptr_t>(b.data);
+    size_t aligned = ((base + alignment - 1) & ~(uintptr_t)(alignment - 1)) - base;
+    offset = aligned + bytes;
+    return b.data + aligned;
+}
+
+void Arena::reset()
+{
+    if (blocks.size() > 1)
+    {
+        size_t total = capacity();
+        releaseAll();
+        addBlock(total);
+    }
+    offset = 0;
+    usedBefore = 0;
+}
+
+size_t Arena::capacity() const
+{
+    size_t total = 0;
+    for (const Block &b : blocks)
+        total += b.size;
+    return total;
+}
+
+size_t Arena::used() const
+{
+    return usedBefore + offset;
+}
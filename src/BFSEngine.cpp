@@ -0,0 +1,203 @@
+#include "../include/BFSEngine.h"
+#include <algorithm>
+#include <climits>
+
+BFSEngine::BFSEngine(const Graph &g)
+    : graph(nullptr), numVertices(0), epoch(0)
+{
+    attach(g);
+}
+
+void BFSEngine::attach(const Graph &g)
+{
+    graph = &g;
+    if (numVertices != g.getNumVertices())
+    {
+        numVertices = g.getNumVertices();
+        stamp.assign(numVertices, 0);
+        dist.assign(numVertices, 0);
+        queue.reserve(numVertices);
+        epoch = 0;
+    }
+}
+
+void BFSEngine::nextEpoch()
+{
+    ++epoch;
+    if (epoch == 0)
+    {
+        // Contador deu a volta: limpa as marcas uma vez
+        std::fill(stamp.begin(), stamp.end(), 0);
+        epoch = 1;
+    }
+}
+
+int BFSEngine::distance(int u, int v)
+{
+    if (!graph->isValidVertex(u) || !graph->isValidVertex(v))
+    {
+        return -1;
+    }
+
+    if (u == v)
+        return 0;
+
+    nextEpoch();
+    queue.clear();
+    stamp[u] = epoch;
+    dist[u] = 0;
+    queue.push_back(u);
+
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        int current = queue[head];
+        for (int neighbor : graph->getNeighbors(current))
+        {
+            if (stamp[neighbor] != epoch)
+            {
+                stamp[neighbor] = epoch;
+                dist[neighbor] = dist[current] + 1;
+                if (neighbor == v)
+                {
+                    return dist[v];
+                }
+                queue.push_back(neighbor);
+            }
+        }
+    }
+
+    return -1;
+}
+
+const std::vector<int> &BFSEngine::run(const std::vector<int> &sources, int maxDepth)
+{
+    nextEpoch();
+    queue.clear();
+    for (int s : sources)
+    {
+        if (graph->isValidVertex(s) && stamp[s] != epoch)
+        {
+            stamp[s] = epoch;
+            dist[s] = 0;
+            queue.push_back(s);
+        }
+    }
+
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        int current = queue[head];
+        if (maxDepth >= 0 && dist[current] >= maxDepth)
+            continue;
+        for (int neighbor : graph->getNeighbors(current))
+        {
+            if (stamp[neighbor] != epoch)
+            {
+                stamp[neighbor] = epoch;
+                dist[neighbor] = dist[current] + 1;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+
+    return queue;
+}
+
+std::vector<std::vector<int>> BFSEngine::layers(int source, int k)
+{
+    std::vector<std::vector<int>> result(std::max(0, k + 1));
+    if (k < 0)
+        return result;
+
+    for (int v : run({source}, k))
+    {
+        result[dist[v]].push_back(v);
+    }
+    return result;
+}
+
+// Uma rodada bit-paralela: o bit i de cada palavra pertence à fonte i
+void BFSEngine::eccentricityBatch(const int *sources, int count, int *out)
+{
+    visited.assign(numVertices, 0);
+    frontier.assign(numVertices, 0);
+    next.assign(numVertices, 0);
+
+    for (int i = 0; i < count; ++i)
+    {
+        uint64_t bit = uint64_t(1) << i;
+        visited[sources[i]] |= bit;
+        frontier[sources[i]] |= bit;
+        out[i] = 0;
+    }
+
+    for (int level = 1;; ++level)
+    {
+        uint64_t reached = 0;
+        for (int v = 0; v < numVertices; ++v)
+        {
+            uint64_t incoming = 0;
+            for (int u : graph->getNeighbors(v))
+                incoming |= frontier[u];
+            next[v] = incoming & ~visited[v];
+            reached |= next[v];
+        }
+
+        if (reached == 0)
+            break;
+
+        for (int v = 0; v < numVertices; ++v)
+            visited[v] |= next[v];
+        frontier.swap(next);
+
+        // As fontes que ainda alcançam vértices novos têm excentricidade >= level
+        while (reached)
+        {
+            int i = __builtin_ctzll(reached);
+            out[i] = level;
+            reached &= reached - 1;
+        }
+    }
+}
+
+std::vector<int> BFSEngine::eccentricities(const std::vector<int> &sources)
+{
+    std::vector<int> result(sources.size(), 0);
+    for (size_t start = 0; start < sources.size(); start += 64)
+    {
+        int count = static_cast<int>(std::min<size_t>(64, sources.size() - start));
+        eccentricityBatch(sources.data() + start, count, result.data() + start);
+    }
+    return result;
+}
+
+BFSEngine::DistanceStats BFSEngine::distanceStats()
+{
+    DistanceStats stats = {0, 0, 0.0, 0};
+    if (numVertices == 0)
+        return stats;
+
+    std::vector<int> all(numVertices);
+    for (int v = 0; v < numVertices; ++v)
+        all[v] = v;
+    std::vector<int> ecc = eccentricities(all);
+
+    stats.diameter = *std::max_element(ecc.begin(), ecc.end());
+    stats.radius = *std::min_element(ecc.begin(), ecc.end());
+    long long sum = 0;
+    for (int e : ecc)
+        sum += e;
+    stats.averageEccentricity = static_cast<double>(sum) / numVertices;
+
+    // Componentes: cada BFS a partir de um vértice ainda não alcançado
+    std::vector<char> seen(numVertices, 0);
+    for (int v = 0; v < numVertices; ++v)
+    {
+        if (seen[v])
+            continue;
+        ++stats.components;
+        for (int u : run({v}))
+            seen[u] = 1;
+    }
+
+    return stats;
+}
@@ -0,0 +1,434 @@
+#include "../include/BatchPipeline.h"
+#include "../include/BoundedQueue.h"
+#include "../include/Config.h"
+#include "../include/InputReader.h"
+#include "../include/LowerBound.h"
+#include "../include/OutputWriter.h"
+#include "../include/ResultLogger.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+    // Instância em trânsito entre os estágios
+    struct Item
+    {
+        size_t index;
+        std::unique_ptr<Graph> graph;
+        SolverResult result;
+    };
+
+    using ItemQueue = BoundedQueue<std::unique_ptr<Item>>;
+
+    double secondsSince(std::chrono::high_resolution_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+        return elapsed.count();
+    }
+
+    // Nome do arquivo sem diretório e sem extensão
+    std::string stemOf(const std::string &path)
+    {
+        size_t slash = path.find_last_of('/');
+        std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+        size_t dot = name.find_last_of('.');
+        return dot == std::string::npos || dot == 0 ? name : name.substr(0, dot);
+    }
+
+    void printBatchUsage(const char *programName)
+    {
+        std::cerr << "\nUso: " << programName << " batch <lista> [opções]" << std::endl;
+        std::cerr << "  <lista>          Arquivo com um caminho de instância por linha" << std::endl;
+        std::cerr << "  -a <algoritmo>   greedy|dsatur|grasp|reactive|tabu|exact (padrão: greedy)" << std::endl;
+        std::cerr << "  -p, -q, -s, --alpha, --iter, --block, --elite, --rcl-sample, --threads, --tabu-init," << std::endl;
+        std::cerr << "  --node-limit, --time-limit" << std::endl;
+        std::cerr << "                   Como na execução de uma instância" << std::endl;
+        std::cerr << "  --out-dir <dir>  Grava a solução de cada instância em <dir>/<nome>.txt" << std::endl;
+        std::cerr << "  --viz            Grava também <dir>/<nome>_viz.txt" << std::endl;
+        std::cerr << "  --queue <n>      Capacidade das filas entre os estágios (padrão: 1)" << std::endl;
+        std::cerr << "  --jobs <n>       Instâncias resolvidas em paralelo, com roubo de trabalho (padrão: 1; 0 = todos os núcleos)" << std::endl;
+    }
+}
+
+BatchPipeline::BatchPipeline(std::vector<std::string> list, Settings s)
+    : instances(std::move(list)), settings(std::move(s)), wallSeconds(0.0), busySeconds{}
+{
+}
+
+bool BatchPipeline::readList(const std::string &filename, std::vector<std::string> &list)
+{
+    std::ifstream in(filename);
+    if (!in)
+    {
+        std::cerr << "Erro: não foi possível abrir a lista " << filename << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line))
+    {
+        line = line.substr(0, line.find('#'));
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos)
+            continue;
+        size_t last = line.find_last_not_of(" \t\r");
+        list.push_back(line.substr(first, last - first + 1));
+    }
+    return true;
+}
+
+bool BatchPipeline::run()
+{
+    const size_t total = instances.size();
+    stats.assign(total, InstanceStats());
+    std::fill(busySeconds, busySeconds + NUM_STAGES, 0.0);
+
+    ItemQueue loaded(settings.queueCapacity);
+    ItemQueue solved(settings.queueCapacity);
+    ItemQueue validated(settings.queueCapacity);
+
+    auto wallStart = std::chrono::high_resolution_clock::now();
+
+    // Estágio 1: leitura, índice de distância 2 e limite inferior
+    std::thread loader([&]()
+                       {
+        for (size_t k = 0; k < total; ++k)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            std::unique_ptr<Item> item(new Item{k, std::unique_ptr<Graph>(new Graph()), SolverResult()});
+            InstanceStats &st = stats[k];
+            st.instance = instances[k];
+            st.loaded = InputReader::readGraphAuto(instances[k], *item->graph);
+            if (st.loaded)
+            {
+                item->graph->buildDistance2Index();
+                st.vertices = item->graph->getNumVertices();
+                st.lowerBound = LowerBound::compute(*item->graph, settings.options.p, settings.options.q);
+            }
+            st.loadSeconds = secondsSince(start);
+            busySeconds[LOAD] += st.loadSeconds;
+            loaded.push(std::move(item));
+        }
+        loaded.close(); });
+
+    // Estágio 3: validação
+    std::thread validator([&]()
+                          {
+        std::unique_ptr<Item> item;
+        while (solved.pop(item))
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            InstanceStats &st = stats[item->index];
+            if (st.solved)
+            {
+                const std::vector<int> &coloring = item->result.coloring;
+                st.maxColor = coloring.empty() ? 0 : *std::max_element(coloring.begin(), coloring.end());
+                st.valid = OutputWriter::validateColoring(*item->graph, coloring,
+                                                          settings.options.p, settings.options.q);
+            }
+            st.validateSeconds = secondsSince(start);
+            busySeconds[VALIDATE] += st.validateSeconds;
+            validated.push(std::move(item));
+        }
+        validated.close(); });
+
+    // Estágio 4: arquivos de saída, CSV e progresso
+    std::thread writer([&]()
+                       {
+        ResultLogger logger(Config::DEFAULT_CSV_FILE);
+        const SolverOptions &opt = settings.options;
+        std::unique_ptr<Item> item;
+        size_t done = 0;
+        while (validated.pop(item))
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            InstanceStats &st = stats[item->index];
+            if (st.solved)
+            {
+                const std::vector<int> &coloring = item->result.coloring;
+                if (!settings.outputDir.empty())
+                {
+                    const std::string base = settings.outputDir + "/" + stemOf(st.instance);
+                    OutputWriter::writeSolution(base + ".txt", coloring, st.maxColor);
+                    if (settings.writeVisualization)
+                        OutputWriter::writeGraphVisualization(base + "_viz.txt", *item->graph, coloring);
+                }
+
+                const bool grasp = opt.algorithm == Config::ALGORITHM_GRASP;
+                const bool reactive = opt.algorithm == Config::ALGORITHM_REACTIVE;
+                const bool tabu = opt.algorithm == Config::ALGORITHM_TABU;
+                logger.logResult(st.instance, opt.algorithm, opt.p, opt.q,
+                                 grasp ? opt.alpha : -1.0,
+                                 grasp || reactive || tabu ? opt.iterations : 0,
+                                 reactive ? opt.blockSize : 0,
+                                 st.seed, st.solveSeconds, st.maxColor,
+                                 reactive ? item->result.bestAlphaUsed : -1.0,
+                                 grasp || reactive ? item->result.averageSolution : -1.0,
+                                 st.lowerBound, item->result.rclSampleSize);
+            }
+            item.reset(); // libera o grafo antes de esperar o próximo
+            st.writeSeconds = secondsSince(start);
+            busySeconds[WRITE] += st.writeSeconds;
+
+            ++done;
+            std::cout << "[" << done << "/" << total << "] " << st.instance << ": ";
+            if (!st.loaded)
+                std::cout << "falha na leitura";
+            else if (!st.solved)
+                std::cout << "falha na resolução";
+            else
+                std::cout << st.vertices << " vértices, maior cor " << st.maxColor << " (limite "
+                          << st.lowerBound << ")" << (st.valid ? "" : " INVÁLIDA") << "; leitura "
+                          << st.loadSeconds << " s, resolução " << st.solveSeconds << " s, validação "
+                          << st.validateSeconds << " s, gravação " << st.writeSeconds << " s";
+            std::cout << std::endl;
+        } });
+
+    // Estágio 2: resolução, na thread principal ou em jobs workers
+    {
+        std::mutex solveMutex;
+        auto solveItem = [&](Item &item)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            InstanceStats &st = stats[item.index];
+            if (st.loaded)
+            {
+                SolverOptions opt = settings.options;
+                opt.lowerBound = st.lowerBound;
+                opt.verbose = false;
+                opt.randomSeed = settings.seed + 0x9E3779B9u * static_cast<unsigned int>(item.index + 1);
+                if (opt.randomSeed == 0)
+                    opt.randomSeed = 1;
+                st.seed = opt.randomSeed;
+                item.result = Solver::run(*item.graph, opt);
+                st.solved = item.result.ok &&
+                            (st.vertices == 0 || !item.result.coloring.empty());
+                st.lowerBound = std::max(st.lowerBound, item.result.provenBound);
+            }
+            st.solveSeconds = secondsSince(start);
+            std::lock_guard<std::mutex> lock(solveMutex);
+            busySeconds[SOLVE] += st.solveSeconds;
+        };
+
+        std::unique_ptr<WorkStealingScheduler> scheduler;
+        if (settings.jobs > 1)
+            scheduler.reset(new WorkStealingScheduler(settings.jobs));
+
+        // Instâncias despachadas e ainda não entregues à validação: limitam os
+        // grafos em memória como a capacidade das filas
+        const size_t maxInFlight = static_cast<size_t>(settings.jobs) + settings.queueCapacity;
+        std::condition_variable slotFree;
+        size_t inFlight = 0;
+
+        std::unique_ptr<Item> item;
+        while (loaded.pop(item))
+        {
+            if (!scheduler)
+            {
+                solveItem(*item);
+                solved.push(std::move(item));
+                continue;
+            }
+            {
+                std::unique_lock<std::mutex> lock(solveMutex);
+                slotFree.wait(lock, [&]
+                              { return inFlight < maxInFlight; });
+                ++inFlight;
+            }
+            // std::function exige tarefa copiável: a posse passa por ponteiro
+            Item *raw = item.release();
+            scheduler->submit([&, raw](int)
+                              {
+                std::unique_ptr<Item> owned(raw);
+                solveItem(*owned);
+                solved.push(std::move(owned));
+                {
+                    std::lock_guard<std::mutex> lock(solveMutex);
+                    --inFlight;
+                }
+                slotFree.notify_one(); });
+        }
+        if (scheduler)
+        {
+            scheduler->wait();
+            schedulerStats = scheduler->getStats();
+        }
+        solved.close();
+    }
+
+    loader.join();
+    validator.join();
+    writer.join();
+    wallSeconds = secondsSince(wallStart);
+
+    bool allOk = true;
+    for (const InstanceStats &st : stats)
+        allOk = allOk && st.loaded && st.solved && st.valid;
+    return allOk;
+}
+
+int BatchPipeline::runCommand(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        printBatchUsage(argv[0]);
+        return 1;
+    }
+
+    Settings settings;
+    SolverOptions &opt = settings.options;
+    bool iterationsSet = false;
+    bool blockSizeSet = false;
+    double rclSample = Config::DEFAULT_RCL_SAMPLE;
+    unsigned int customSeed = 0;
+    int queueCapacity = 1;
+    int jobs = 1;
+
+    for (int i = 3; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-a" && i + 1 < argc)
+            opt.algorithm = argv[++i];
+        else if (arg == "-p" && i + 1 < argc)
+            opt.p = std::atoi(argv[++i]);
+        else if (arg == "-q" && i + 1 < argc)
+            opt.q = std::atoi(argv[++i]);
+        else if (arg == "-s" && i + 1 < argc)
+            customSeed = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--alpha" && i + 1 < argc)
+            opt.alpha = std::atof(argv[++i]);
+        else if (arg == "--iter" && i + 1 < argc)
+        {
+            opt.iterations = std::atoi(argv[++i]);
+            iterationsSet = true;
+        }
+        else if (arg == "--block" && i + 1 < argc)
+        {
+            opt.blockSize = std::atoi(argv[++i]);
+            blockSizeSet = true;
+        }
+        else if (arg == "--elite" && i + 1 < argc)
+            opt.eliteSize = std::atoi(argv[++i]);
+        else if (arg == "--rcl-sample" && i + 1 < argc)
+            rclSample = std::atof(argv[++i]);
+        else if (arg == "--threads" && i + 1 < argc)
+            opt.numThreads = std::atoi(argv[++i]);
+        else if (arg == "--tabu-init" && i + 1 < argc)
+            opt.tabuInit = argv[++i];
+        else if (arg == "--node-limit" && i + 1 < argc)
+            opt.nodeLimit = std::atoll(argv[++i]);
+        else if (arg == "--time-limit" && i + 1 < argc)
+            opt.timeLimit = std::atof(argv[++i]);
+        else if (arg == "--out-dir" && i + 1 < argc)
+            settings.outputDir = argv[++i];
+        else if (arg == "--viz")
+            settings.writeVisualization = true;
+        else if (arg == "--queue" && i + 1 < argc)
+            queueCapacity = std::atoi(argv[++i]);
+        else if (arg == "--jobs" && i + 1 < argc)
+            jobs = std::atoi(argv[++i]);
+        else
+        {
+            std::cerr << "Erro: opção desconhecida no lote: " << arg << std::endl;
+            printBatchUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (opt.algorithm != Config::ALGORITHM_GREEDY && opt.algorithm != Config::ALGORITHM_GRASP &&
+        opt.algorithm != Config::ALGORITHM_REACTIVE && opt.algorithm != Config::ALGORITHM_TABU &&
+        opt.algorithm != Config::ALGORITHM_EXACT && opt.algorithm != Config::ALGORITHM_DSATUR)
+    {
+        std::cerr << "Erro: algoritmo não suportado no lote: " << opt.algorithm << std::endl;
+        return 1;
+    }
+    if (queueCapacity < 1)
+    {
+        std::cerr << "Erro: --queue deve ser >= 1" << std::endl;
+        return 1;
+    }
+    if (settings.writeVisualization && settings.outputDir.empty())
+    {
+        std::cerr << "Erro: --viz requer --out-dir" << std::endl;
+        return 1;
+    }
+    settings.queueCapacity = static_cast<size_t>(queueCapacity);
+    if (jobs <= 0)
+        jobs = std::max(1u, std::thread::hardware_concurrency());
+    settings.jobs = jobs;
+
+    if (opt.algorithm == Config::ALGORITHM_REACTIVE)
+    {
+        if (!iterationsSet)
+            opt.iterations = Config::DEFAULT_REACTIVE_ITERATIONS;
+        if (!blockSizeSet)
+            opt.blockSize = Config::DEFAULT_BLOCK_SIZE_GRASPR;
+    }
+    else if (opt.algorithm == Config::ALGORITHM_TABU && !iterationsSet)
+    {
+        opt.iterations = Config::DEFAULT_TABU_ITERATIONS;
+    }
+    if (opt.numThreads <= 0)
+        opt.numThreads = std::max(1u, std::thread::hardware_concurrency());
+    opt.rclSampleCount = rclSample >= 1.0 ? static_cast<int>(rclSample) : 0;
+    opt.rclSampleFraction = rclSample >= 1.0 ? 0.0 : rclSample;
+
+    if (customSeed == 0)
+    {
+        auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::high_resolution_clock::now().time_since_epoch())
+                          .count();
+        customSeed = static_cast<unsigned int>(micros ^ getpid());
+    }
+    settings.seed = customSeed;
+
+    std::vector<std::string> list;
+    if (!readList(argv[2], list))
+        return 1;
+    if (list.empty())
+    {
+        std::cerr << "Erro: lista de instâncias vazia" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Lote: " << list.size() << " instâncias, algoritmo " << opt.algorithm
+              << ", p=" << opt.p << ", q=" << opt.q << ", semente " << settings.seed
+              << ", filas de " << settings.queueCapacity << ", jobs " << settings.jobs << std::endl;
+
+    BatchPipeline pipeline(list, settings);
+    bool ok = pipeline.run();
+
+    const double wall = pipeline.getWallSeconds();
+    const char *names[NUM_STAGES] = {"Leitura + índice", "Resolução", "Validação", "Gravação"};
+    double serial = 0.0;
+    for (int s = 0; s < NUM_STAGES; ++s)
+        serial += pipeline.getBusySeconds(static_cast<Stage>(s));
+
+    std::cout << "\nResumo do lote:" << std::endl;
+    std::cout << "  Tempo total: " << wall << " segundos (soma dos estágios: " << serial
+              << " segundos, sobreposição " << (wall > 0 ? serial / wall : 1.0) << "x)" << std::endl;
+    std::cout << "  Vazão: " << (wall > 0 ? list.size() * 3600.0 / wall : 0.0) << " instâncias/hora" << std::endl;
+    for (int s = 0; s < NUM_STAGES; ++s)
+    {
+        double busy = pipeline.getBusySeconds(static_cast<Stage>(s));
+        std::cout << "  " << names[s] << ": " << busy << " segundos ocupado ("
+                  << (wall > 0 ? 100.0 * busy / wall : 0.0) << "%)" << std::endl;
+    }
+    if (!pipeline.getSchedulerStats().empty())
+    {
+        std::cout << "  Workers de resolução (roubo de trabalho):" << std::endl;
+        WorkStealingScheduler::printStats(pipeline.getSchedulerStats(), std::cout, "    ");
+    }
+    if (!ok)
+    {
+        std::cout << "[AVISO] Há instâncias com falha ou solução inválida" << std::endl;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+#include "../include/BranchAndBoundAlgorithm.h"
+#include "../include/LowerBound.h"
+#include <algorithm>
+#include <climits>
+
+BranchAndBoundAlgorithm::BranchAndBoundAlgorithm(const Graph &g, int p, int q)
+    : graph(g), p_param(p), q_param(q), lowerBound(0), nodeLimit(0), timeLimit(0.0), incumbent(nullptr),
+      n(g.getNumVertices()), colorCap(0), words(0), bestMax(INT_MAX), nodes(0), seconds(0.0),
+      proven(false), aborted(false), bestBound(0)
+{
+    // N1 sem repetições nem laços; N2 vem do índice do grafo
+    n1.resize(n);
+    n2.resize(n);
+    squareDegree.resize(n);
+    for (int v = 0; v < n; ++v)
+    {
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u != v)
+                n1[v].push_back(u);
+        }
+        std::sort(n1[v].begin(), n1[v].end());
+        n1[v].erase(std::unique(n1[v].begin(), n1[v].end()), n1[v].end());
+        n2[v] = graph.getDistance2Neighbors(v);
+        squareDegree[v] = static_cast<int>(n1[v].size() + n2[v].size());
+    }
+}
+
+// Soma (sign = +1) ou retira (sign = -1) as proibições que a cor c de v
+// impõe aos vizinhos; os bits livres acompanham as contagens que cruzam zero
+void BranchAndBoundAlgorithm::place(int v, int c, int sign)
+{
+    const int stride = colorCap + 1;
+    auto apply = [&](const std::vector<int> &nbrs, int separation)
+    {
+        if (separation <= 0)
+            return;
+        const int lo = std::max(1, c - separation + 1);
+        const int hi = std::min(colorCap, c + separation - 1);
+        for (int u : nbrs)
+        {
+            uint32_t *count = blocked.data() + static_cast<size_t>(u) * stride;
+            uint64_t *bits = freeBits.data() + static_cast<size_t>(u) * words;
+            for (int k = lo; k <= hi; ++k)
+            {
+                if (sign > 0)
+                {
+                    if (count[k]++ == 0)
+                        bits[k >> 6] &= ~(uint64_t(1) << (k & 63));
+                }
+                else if (--count[k] == 0)
+                {
+                    bits[k >> 6] |= uint64_t(1) << (k & 63);
+                }
+            }
+        }
+    };
+    apply(n1[v], p_param);
+    apply(n2[v], q_param);
+}
+
+// Cores livres de v em [1, limit]
+int BranchAndBoundAlgorithm::countFree(int v, int limit) const
+{
+    const uint64_t *bits = freeBits.data() + static_cast<size_t>(v) * words;
+    const int full = (limit + 1) >> 6;
+    int total = 0;
+    for (int w = 0; w < full; ++w)
+        total += __builtin_popcountll(bits[w]);
+    const int rest = (limit + 1) & 63;
+    if (rest > 0)
+        total += __builtin_popcountll(bits[full] & ((uint64_t(1) << rest) - 1));
+    return total;
+}
+
+bool BranchAndBoundAlgorithm::limitReached()
+{
+    if (aborted)
+        return true;
+    if (nodeLimit > 0 && nodes >= nodeLimit)
+        aborted = true;
+    else if ((nodes & 1023) == 0)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if ((timeLimit > 0 && elapsed.count() >= timeLimit) || (incumbent && incumbent->shouldStop()))
+            aborted = true;
+    }
+    return aborted;
+}
+
+std::vector<int> BranchAndBoundAlgorithm::solve(const std::vector<int> &initial)
+{
+    start = std::chrono::steady_clock::now();
+    nodes = 0;
+    aborted = false;
+    best = initial;
+    bestMax = initial.empty() ? 0 : *std::max_element(initial.begin(), initial.end());
+    bestBound = std::max(lowerBound, n > 0 ? 1 : 0);
+
+    if (bestMax > bestBound)
+    {
+        colorCap = bestMax - 1;
+        words = (colorCap + 1 + 63) / 64;
+        blocked.assign(static_cast<size_t>(n) * (colorCap + 1), 0);
+        freeBits.assign(static_cast<size_t>(n) * words, 0);
+        for (int v = 0; v < n; ++v)
+        {
+            uint64_t *bits = freeBits.data() + static_cast<size_t>(v) * words;
+            for (int c = 1; c <= colorCap; ++c)
+                bits[c >> 6] |= uint64_t(1) << (c & 63);
+        }
+        coloring.assign(n, 0);
+
+        clique = LowerBound::findSquareClique(graph);
+        search(0, 0);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    seconds = elapsed.count();
+    proven = !aborted;
+    if (proven)
+        bestBound = bestMax;
+    return best;
+}
+
+void BranchAndBoundAlgorithm::search(int depth, int currentMax)
+{
+    ++nodes;
+    if (limitReached())
+        return;
+
+    if (depth == n)
+    {
+        bestMax = currentMax;
+        best = coloring;
+        if (incumbent)
+            incumbent->publish(bestMax);
+        return;
+    }
+
+    // Só interessam colorações com maior cor <= T
+    const int target = bestMax - 1;
+    if (std::max(currentMax, bestBound) > target)
+        return;
+
+    // Verificação adiante e escolha DSATUR: menos cores livres, depois maior
+    // grau em G²; a clique de G² vem antes, em ordem fixa
+    int chosen = -1;
+    int chosenFree = INT_MAX;
+    for (int v = 0; v < n; ++v)
+    {
+        if (coloring[v] != 0)
+            continue;
+        int free = countFree(v, target);
+        if (free == 0)
+            return;
+        if (free < chosenFree || (free == chosenFree && squareDegree[v] > squareDegree[chosen]))
+        {
+            chosen = v;
+            chosenFree = free;
+        }
+    }
+    if (depth < static_cast<int>(clique.size()))
+        chosen = clique[depth];
+
+    const uint64_t *bits = freeBits.data() + static_cast<size_t>(chosen) * words;
+    for (int c = 1; c <= bestMax - 1; ++c)
+    {
+        // Reflexão c -> T + 1 - c: basta a metade inferior para o primeiro vértice
+        if (depth == 0 && c > bestMax / 2)
+            break;
+        if (!(bits[c >> 6] & (uint64_t(1) << (c & 63))))
+            continue;
+
+        place(chosen, c, +1);
+        coloring[chosen] = c;
+        search(depth + 1, std::max(currentMax, c));
+        coloring[chosen] = 0;
+        place(chosen, c, -1);
+
+        if (aborted || bestMax <= bestBound)
+            return;
+    }
+}
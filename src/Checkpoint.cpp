@@ -0,0 +1,311 @@
+#include "../include/Checkpoint.h"
+#include "../include/Graph.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <unistd.h>
+
+namespace
+{
+    constexpr char MAGIC[4] = {'L', 'P', 'Q', 'C'};
+    constexpr uint32_t VERSION = 3;
+
+    constexpr uint64_t FNV_OFFSET = 1469598103934665603ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    inline void fnvMix(uint64_t &hash, uint64_t value)
+    {
+        hash = (hash ^ value) * FNV_PRIME;
+    }
+
+    // Valores gravados na representação nativa (o checkpoint é lido na mesma máquina)
+    template <typename T>
+    void put(std::vector<char> &out, const T &value)
+    {
+        const char *bytes = reinterpret_cast<const char *>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T>
+    void putVector(std::vector<char> &out, const std::vector<T> &values)
+    {
+        put(out, static_cast<uint64_t>(values.size()));
+        const char *bytes = reinterpret_cast<const char *>(values.data());
+        out.insert(out.end(), bytes, bytes + values.size() * sizeof(T));
+    }
+
+    class Reader
+    {
+    public:
+        explicit Reader(const std::vector<char> &data) : data(data), pos(0), ok(true) {}
+
+        template <typename T>
+        void get(T &value)
+        {
+            if (pos + sizeof(T) > data.size())
+            {
+                ok = false;
+                return;
+            }
+            std::memcpy(&value, data.data() + pos, sizeof(T));
+            pos += sizeof(T);
+        }
+
+        template <typename T>
+        void getVector(std::vector<T> &values)
+        {
+            uint64_t count = 0;
+            get(count);
+            if (!ok || count > (data.size() - pos) / sizeof(T))
+            {
+                ok = false;
+                return;
+            }
+            values.resize(count);
+            std::memcpy(values.data(), data.data() + pos, count * sizeof(T));
+            pos += count * sizeof(T);
+        }
+
+        bool good() const { return ok; }
+
+    private:
+        const std::vector<char> &data;
+        size_t pos;
+        bool ok;
+    };
+}
+
+void ReactiveCheckpoint::describeGraph(const Graph &graph)
+{
+    numVertices = graph.getNumVertices();
+    numEdges = 0;
+    graphHash = FNV_OFFSET;
+
+    // Listas ordenadas: a impressão não depende da ordem das arestas no arquivo
+    std::vector<int> sorted;
+    for (int v = 0; v < numVertices; ++v)
+    {
+        sorted = graph.getNeighbors(v);
+        std::sort(sorted.begin(), sorted.end());
+        numEdges += sorted.size();
+        fnvMix(graphHash, static_cast<uint64_t>(sorted.size()));
+        for (int u : sorted)
+            fnvMix(graphHash, static_cast<uint64_t>(u));
+    }
+    numEdges /= 2;
+}
+
+bool ReactiveCheckpoint::matchesGraph(const Graph &graph) const
+{
+    ReactiveCheckpoint current;
+    current.describeGraph(graph);
+    return current.numVertices == numVertices && current.numEdges == numEdges && current.graphHash == graphHash;
+}
+
+uint64_t ReactiveCheckpoint::hashColoring(const std::vector<int> &coloring)
+{
+    uint64_t hash = FNV_OFFSET;
+    fnvMix(hash, static_cast<uint64_t>(coloring.size()));
+    for (int color : coloring)
+        fnvMix(hash, static_cast<uint64_t>(static_cast<uint32_t>(color)));
+    return hash;
+}
+
+std::vector<char> ReactiveCheckpoint::serialize() const
+{
+    std::vector<char> out;
+    out.insert(out.end(), MAGIC, MAGIC + 4);
+    put(out, VERSION);
+    put(out, numVertices);
+    put(out, numEdges);
+    put(out, graphHash);
+    put(out, p);
+    put(out, q);
+    put(out, blockSize);
+    put(out, static_cast<uint8_t>(parallel));
+    put(out, eliteSize);
+    put(out, rclSampleSize);
+    put(out, initialHash);
+    putVector(out, alphaValues);
+    put(out, seed);
+    put(out, rngDraws);
+    put(out, baseSeed);
+    put(out, nextIteration);
+    put(out, iterationsExecuted);
+    put(out, bestMaxColor);
+    put(out, bestIteration);
+    put(out, relinkImprovements);
+    put(out, sumSolutions);
+    put(out, bestAlphaUsed);
+    putVector(out, alphaProbabilities);
+    putVector(out, alphaRewardSum);
+    putVector(out, alphaUsageCount);
+    putVector(out, bestColoring);
+    put(out, static_cast<uint64_t>(elite.size()));
+    for (const auto &member : elite)
+    {
+        put(out, member.first);
+        putVector(out, member.second);
+    }
+    return out;
+}
+
+bool ReactiveCheckpoint::load(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (data.size() < 8 || std::memcmp(data.data(), MAGIC, 4) != 0)
+    {
+        std::cerr << "Erro: checkpoint inválido: " << filename << std::endl;
+        return false;
+    }
+
+    Reader in(data);
+    char magic[4];
+    uint32_t version = 0;
+    uint8_t parallelFlag = 0;
+    in.get(magic);
+    in.get(version);
+    if (version != VERSION)
+    {
+        std::cerr << "Erro: versão de checkpoint não suportada: " << version << std::endl;
+        return false;
+    }
+
+    in.get(numVertices);
+    in.get(numEdges);
+    in.get(graphHash);
+    in.get(p);
+    in.get(q);
+    in.get(blockSize);
+    in.get(parallelFlag);
+    parallel = parallelFlag != 0;
+    in.get(eliteSize);
+    in.get(rclSampleSize);
+    in.get(initialHash);
+    in.getVector(alphaValues);
+    in.get(seed);
+    in.get(rngDraws);
+    in.get(baseSeed);
+    in.get(nextIteration);
+    in.get(iterationsExecuted);
+    in.get(bestMaxColor);
+    in.get(bestIteration);
+    in.get(relinkImprovements);
+    in.get(sumSolutions);
+    in.get(bestAlphaUsed);
+    in.getVector(alphaProbabilities);
+    in.getVector(alphaRewardSum);
+    in.getVector(alphaUsageCount);
+    in.getVector(bestColoring);
+
+    uint64_t eliteCount = 0;
+    in.get(eliteCount);
+    elite.clear();
+    for (uint64_t i = 0; i < eliteCount && in.good(); ++i)
+    {
+        std::pair<int, std::vector<int>> member;
+        in.get(member.first);
+        in.getVector(member.second);
+        elite.push_back(std::move(member));
+    }
+
+    if (!in.good())
+    {
+        std::cerr << "Erro: checkpoint truncado: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+CheckpointWriter::CheckpointWriter(const std::string &file)
+    : filename(file), hasPending(false), writing(false), stopping(false), writesCompleted(0)
+{
+    worker = std::thread(&CheckpointWriter::run, this);
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cv.notify_all();
+    worker.join();
+}
+
+void CheckpointWriter::submit(std::vector<char> bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = std::move(bytes);
+        hasPending = true;
+    }
+    cv.notify_all();
+}
+
+void CheckpointWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return !hasPending && !writing; });
+}
+
+int CheckpointWriter::getWritesCompleted() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return writesCompleted;
+}
+
+void CheckpointWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        cv.wait(lock, [this] { return hasPending || stopping; });
+        if (!hasPending)
+            break; // parando sem nada pendente
+
+        std::vector<char> bytes = std::move(pending);
+        hasPending = false;
+        writing = true;
+        lock.unlock();
+
+        bool ok = writeAtomically(bytes);
+
+        lock.lock();
+        writing = false;
+        if (ok)
+            ++writesCompleted;
+        cv.notify_all();
+    }
+}
+
+bool CheckpointWriter::writeAtomically(const std::vector<char> &bytes) const
+{
+    std::string temp = filename + ".tmp";
+    FILE *file = std::fopen(temp.c_str(), "wb");
+    if (!file)
+    {
+        std::cerr << "Erro: não foi possível criar o checkpoint " << temp << std::endl;
+        return false;
+    }
+
+    bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+    ok = (std::fflush(file) == 0) && ok;
+    ok = (fsync(fileno(file)) == 0) && ok;
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || std::rename(temp.c_str(), filename.c_str()) != 0)
+    {
+        std::cerr << "Erro ao gravar o checkpoint " << filename << std::endl;
+        std::remove(temp.c_str());
+        return false;
+    }
+    return true;
+}
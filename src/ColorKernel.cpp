@@ -0,0 +1,184 @@
+#include "../include/ColorKernel.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define COLOR_KERNEL_X86 1
+#endif
+
+namespace
+{
+    using JumpFn = int (*)(const int *, size_t, int, int);
+
+    JumpFn jumpFor(ColorKernel::Isa isa)
+    {
+        switch (isa)
+        {
+        case ColorKernel::Isa::AVX2:
+            return ColorKernel::violationJumpAVX2;
+        case ColorKernel::Isa::SSE2:
+            return ColorKernel::violationJumpSSE2;
+        default:
+            return ColorKernel::violationJumpScalar;
+        }
+    }
+
+    ColorKernel::Isa activeIsa = ColorKernel::detect();
+    JumpFn activeJump = jumpFor(activeIsa);
+}
+
+ColorKernel::Isa ColorKernel::detect()
+{
+#ifdef COLOR_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return Isa::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return Isa::SSE2;
+#endif
+    return Isa::Scalar;
+}
+
+ColorKernel::Isa ColorKernel::select(Isa isa)
+{
+    Isa best = detect();
+    if (static_cast<int>(isa) > static_cast<int>(best))
+        isa = best;
+    activeIsa = isa;
+    activeJump = jumpFor(isa);
+    return activeIsa;
+}
+
+ColorKernel::Isa ColorKernel::active()
+{
+    return activeIsa;
+}
+
+const char *ColorKernel::name(Isa isa)
+{
+    switch (isa)
+    {
+    case Isa::AVX2:
+        return "avx2";
+    case Isa::SSE2:
+        return "sse2";
+    default:
+        return "scalar";
+    }
+}
+
+bool ColorKernel::parse(const std::string &text, Isa &isa)
+{
+    if (text == "scalar")
+        isa = Isa::Scalar;
+    else if (text == "sse2")
+        isa = Isa::SSE2;
+    else if (text == "avx2")
+        isa = Isa::AVX2;
+    else if (text == "auto")
+        isa = detect();
+    else
+        return false;
+    return true;
+}
+
+int ColorKernel::violationJump(const int *colors, size_t count, int color, int separation)
+{
+    return activeJump(colors, count, color, separation);
+}
+
+int ColorKernel::smallestClearing(const int *n1Colors, size_t n1Count, int p,
+                                  const int *n2Colors, size_t n2Count, int q,
+                                  int start)
+{
+    int color = start;
+    while (true)
+    {
+        int jump = std::max(activeJump(n1Colors, n1Count, color, p),
+                            activeJump(n2Colors, n2Count, color, q));
+        if (jump == 0)
+            return color;
+        color = jump;
+    }
+}
+
+int ColorKernel::violationJumpScalar(const int *colors, size_t count, int color, int separation)
+{
+    int jump = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        int c = colors[i];
+        int diff = color - c;
+        if (c != 0 && diff < separation && -diff < separation)
+            jump = std::max(jump, c + separation);
+    }
+    return jump;
+}
+
+#ifdef COLOR_KERNEL_X86
+
+// SSE2 não tem abs nem max de inteiros de 32 bits: |d| < s vira
+// (s > d) & (s > -d) e o máximo é feito por comparação e seleção
+int ColorKernel::violationJumpSSE2(const int *colors, size_t count, int color, int separation)
+{
+    const __m128i vColor = _mm_set1_epi32(color);
+    const __m128i vSep = _mm_set1_epi32(separation);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vMax = zero;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(colors + i));
+        __m128i d = _mm_sub_epi32(vColor, c);
+        __m128i negD = _mm_sub_epi32(zero, d);
+        __m128i viol = _mm_and_si128(_mm_cmpgt_epi32(vSep, d), _mm_cmpgt_epi32(vSep, negD));
+        viol = _mm_andnot_si128(_mm_cmpeq_epi32(c, zero), viol);
+        __m128i cand = _mm_and_si128(viol, _mm_add_epi32(c, vSep));
+        __m128i greater = _mm_cmpgt_epi32(cand, vMax);
+        vMax = _mm_or_si128(_mm_and_si128(greater, cand), _mm_andnot_si128(greater, vMax));
+    }
+
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), vMax);
+    int jump = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    return std::max(jump, violationJumpScalar(colors + i, count - i, color, separation));
+}
+
+__attribute__((target("avx2")))
+int ColorKernel::violationJumpAVX2(const int *colors, size_t count, int color, int separation)
+{
+    const __m256i vColor = _mm256_set1_epi32(color);
+    const __m256i vSep = _mm256_set1_epi32(separation);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i vMax = zero;
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(colors + i));
+        __m256i diff = _mm256_abs_epi32(_mm256_sub_epi32(vColor, c));
+        __m256i viol = _mm256_andnot_si256(_mm256_cmpeq_epi32(c, zero), _mm256_cmpgt_epi32(vSep, diff));
+        vMax = _mm256_max_epi32(vMax, _mm256_and_si256(viol, _mm256_add_epi32(c, vSep)));
+    }
+
+    __m128i m = _mm_max_epi32(_mm256_castsi256_si128(vMax), _mm256_extracti128_si256(vMax, 1));
+    m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    int jump = _mm_cvtsi128_si32(m);
+    return std::max(jump, violationJumpScalar(colors + i, count - i, color, separation));
+}
+
+#else
+
+int ColorKernel::violationJumpSSE2(const int *colors, size_t count, int color, int separation)
+{
+    return violationJumpScalar(colors, count, color, separation);
+}
+
+int ColorKernel::violationJumpAVX2(const int *colors, size_t count, int color, int separation)
+{
+    return violationJumpScalar(colors, count, color, separation);
+}
+
+#endif
@@ -0,0 +1,135 @@
+#include "../include/CompactGraph.h"
+#include "../include/ConstructionEngine.h"
+#include "../include/VertexOrdering.h"
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+    template <typename Index, typename Color>
+    std::vector<int> runGreedy(const Graph &g, int p, int q, const std::vector<int> &order)
+    {
+        CompactNeighborhoods<Index> nb(g);
+        CompactGreedy<Index, Color> greedy(nb, p, q);
+        return greedy.solve(order);
+    }
+
+    // Construções repetidas por pelo menos minSeconds (e no mínimo 3 vezes)
+    template <typename Construct>
+    double constructionsPerSecond(Construct construct, double minSeconds = 0.3)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        int runs = 0;
+        double elapsed = 0.0;
+        while (runs < 3 || elapsed < minSeconds)
+        {
+            construct();
+            ++runs;
+            elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        }
+        return runs / elapsed;
+    }
+
+    template <typename Index, typename Color>
+    void reportWidth(const Graph &g, int p, int q, const std::vector<int> &order, std::ostream &out)
+    {
+        CompactNeighborhoods<Index> nb(g);
+        CompactGreedy<Index, Color> greedy(nb, p, q);
+        greedy.solve(order);
+        double rate = constructionsPerSecond([&]()
+                                             { greedy.solve(order); });
+        size_t bytes = nb.bytes() + greedy.workingBytes();
+        out << "  ids " << 8 * sizeof(Index) << " bits, cores " << 8 * sizeof(Color) << " bits: "
+            << bytes / 1024.0 << " KiB (" << static_cast<double>(nb.bytes()) / std::max<size_t>(1, nb.getNumEntries())
+            << " bytes por entrada de N1/N2), " << rate << " construções/s" << std::endl;
+    }
+}
+
+bool CompactGraph::parseWidth(const std::string &text, int &bits)
+{
+    if (text == "auto")
+        bits = 0;
+    else if (text == "16")
+        bits = 16;
+    else if (text == "32")
+        bits = 32;
+    else if (text == "int")
+        bits = -1;
+    else
+        return false;
+    return true;
+}
+
+long long CompactGraph::colorBound(const Graph &g, int p, int q)
+{
+    const long long w1 = std::max(0, 2 * p - 1);
+    const long long w2 = std::max(0, 2 * q - 1);
+    long long worst = 0;
+    for (int v = 0; v < g.getNumVertices(); ++v)
+    {
+        long long forbidden = w1 * static_cast<long long>(g.getNeighbors(v).size()) +
+                              w2 * static_cast<long long>(g.getDistance2Neighbors(v).size());
+        worst = std::max(worst, forbidden);
+    }
+    return worst + 1;
+}
+
+bool CompactGraph::chooseWidths(const Graph &g, int p, int q, int requested, int &indexBits, int &colorBits)
+{
+    const bool idsFit16 = g.getNumVertices() <= static_cast<int>(std::numeric_limits<uint16_t>::max()) + 1;
+    const bool colorsFit16 = colorBound(g, p, q) <= std::numeric_limits<uint16_t>::max();
+
+    if (requested == 16 && (!idsFit16 || !colorsFit16))
+        return false;
+    if (requested == 32)
+    {
+        indexBits = colorBits = 32;
+        return true;
+    }
+    indexBits = idsFit16 ? 16 : 32;
+    colorBits = colorsFit16 ? 16 : 32;
+    return true;
+}
+
+std::vector<int> CompactGraph::greedy(const Graph &g, int p, int q, int indexBits, int colorBits,
+                                      const std::vector<int> &order)
+{
+    if (indexBits == 16)
+        return colorBits == 16 ? runGreedy<uint16_t, uint16_t>(g, p, q, order)
+                               : runGreedy<uint16_t, uint32_t>(g, p, q, order);
+    return colorBits == 16 ? runGreedy<uint32_t, uint16_t>(g, p, q, order)
+                           : runGreedy<uint32_t, uint32_t>(g, p, q, order);
+}
+
+void CompactGraph::report(const Graph &g, int p, int q, std::ostream &out)
+{
+    const std::vector<int> order = VertexOrdering::byDegree(g);
+    const int n = g.getNumVertices();
+
+    // Referência: listas de int do Graph e o motor de construção
+    size_t entries = 0;
+    for (int v = 0; v < n; ++v)
+        entries += g.getNeighbors(v).size() + g.getDistance2Neighbors(v).size();
+    size_t intBytes = entries * sizeof(int) + 2 * static_cast<size_t>(n) * sizeof(std::vector<int>) +
+                      static_cast<size_t>(n) * (sizeof(int) + sizeof(uint8_t));
+    ConstructionEngine<StaticOrderSelection, StdRandRng, LowestIdTieBreak> engine(g, p, q, StaticOrderSelection(order));
+    double intRate = constructionsPerSecond([&]()
+                                            { engine.construct(); });
+
+    out << "Larguras de id/cor (guloso, limite de cor " << colorBound(g, p, q) << "):" << std::endl;
+    out << "  int (Graph): " << intBytes / 1024.0 << " KiB ("
+        << static_cast<double>(entries * sizeof(int) + 2 * static_cast<size_t>(n) * sizeof(std::vector<int>)) /
+               std::max<size_t>(1, entries)
+        << " bytes por entrada de N1/N2), " << intRate << " construções/s" << std::endl;
+
+    reportWidth<uint32_t, uint32_t>(g, p, q, order, out);
+    int indexBits, colorBits;
+    chooseWidths(g, p, q, 0, indexBits, colorBits);
+    if (indexBits == 16 && colorBits == 16)
+        reportWidth<uint16_t, uint16_t>(g, p, q, order, out);
+    else if (indexBits == 16)
+        reportWidth<uint16_t, uint32_t>(g, p, q, order, out);
+    else if (colorBits == 16)
+        reportWidth<uint32_t, uint16_t>(g, p, q, order, out);
+}
@@ -0,0 +1,185 @@
+#include "../include/ComponentDecomposition.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+ComponentDecomposition::ComponentDecomposition(const Graph &g)
+    : graph(g), localIndex(g.getNumVertices(), -1)
+{
+    int n = graph.getNumVertices();
+    const bool useIndex = graph.hasDistance2Index();
+
+    // BFS por N1 e, se houver índice, também por N2: num subgrafo com
+    // restrições herdadas, pares a distância 2 podem não ter caminho interno
+    std::vector<int> queue;
+    queue.reserve(n);
+    for (int v = 0; v < n; ++v)
+    {
+        if (localIndex[v] >= 0)
+            continue;
+        queue.clear();
+        queue.push_back(v);
+        localIndex[v] = 0;
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            int current = queue[head];
+            auto visit = [&](int u)
+            {
+                if (localIndex[u] < 0)
+                {
+                    localIndex[u] = 0;
+                    queue.push_back(u);
+                }
+            };
+            for (int u : graph.getNeighbors(current))
+                visit(u);
+            if (useIndex)
+            {
+                for (int u : graph.getDistance2Neighbors(current))
+                    visit(u);
+            }
+        }
+
+        std::vector<int> members = queue;
+        std::sort(members.begin(), members.end());
+        for (size_t i = 0; i < members.size(); ++i)
+            localIndex[members[i]] = static_cast<int>(i);
+        components.push_back(std::move(members));
+    }
+
+    // Maiores primeiro (empate: menor vértice), para balancear as threads
+    std::stable_sort(components.begin(), components.end(),
+                     [](const std::vector<int> &a, const std::vector<int> &b)
+                     { return a.size() > b.size(); });
+}
+
+int ComponentDecomposition::getNumIsolated() const
+{
+    int isolated = 0;
+    for (const auto &members : components)
+    {
+        if (members.size() == 1)
+            ++isolated;
+    }
+    return isolated;
+}
+
+Graph ComponentDecomposition::buildSubgraph(int c) const
+{
+    const std::vector<int> &members = components[c];
+    Graph sub(static_cast<int>(members.size()), false);
+
+    // Cada aresta aparece nas listas das duas pontas: insere só a partir da menor
+    for (size_t i = 0; i < members.size(); ++i)
+    {
+        for (int u : graph.getNeighbors(members[i]))
+        {
+            if (u > members[i])
+                sub.addEdge(static_cast<int>(i), localIndex[u]);
+        }
+    }
+
+    if (!graph.hasDistance2Index())
+    {
+        sub.buildDistance2Index();
+        return sub;
+    }
+
+    // Restringe o índice do grafo original (preserva restrições herdadas)
+    std::vector<std::vector<int>> lists(members.size());
+    for (size_t i = 0; i < members.size(); ++i)
+    {
+        const std::vector<int> &dist2 = graph.getDistance2Neighbors(members[i]);
+        lists[i].reserve(dist2.size());
+        for (int u : dist2)
+            lists[i].push_back(localIndex[u]);
+    }
+    sub.setDistance2Index(std::move(lists));
+    return sub;
+}
+
+SolverResult ComponentDecomposition::solve(const SolverOptions &options, int numWorkers,
+                                           std::vector<ComponentStats> *stats,
+                                           std::vector<WorkStealingScheduler::WorkerStats> *workerStats) const
+{
+    SolverResult result;
+    result.coloring.assign(graph.getNumVertices(), 0);
+
+    // Uma semente por componente, derivada de uma única base
+    const unsigned int baseSeed = options.randomSeed != 0 ? options.randomSeed
+                                                         : static_cast<unsigned int>(std::rand());
+
+    std::vector<int> pending;
+    for (int c = 0; c < getNumComponents(); ++c)
+    {
+        if (components[c].size() == 1)
+            result.coloring[components[c][0]] = 1;
+        else
+            pending.push_back(c);
+    }
+
+    std::vector<ComponentStats> solved(pending.size());
+    std::vector<int> sampleSizes(pending.size(), 0);
+    std::vector<uint8_t> failed(pending.size(), 0);
+
+    // Componentes de tamanhos muito desiguais: o roubo de trabalho reequilibra
+    // as threads que ficaram com as menores
+    int threads = std::max(1, std::min(numWorkers, static_cast<int>(pending.size())));
+    WorkStealingScheduler scheduler(threads);
+    scheduler.parallelFor(0, static_cast<int>(pending.size()), [&](int k, int)
+                          {
+        int c = pending[k];
+        const std::vector<int> &members = components[c];
+        auto start = std::chrono::high_resolution_clock::now();
+
+        Graph sub = buildSubgraph(c);
+
+        SolverOptions local = options;
+        local.numThreads = 1;
+        local.verbose = false;
+        local.checkpointFile.clear();
+        local.randomSeed = baseSeed + 0x9E3779B9u * static_cast<unsigned int>(c + 1);
+        if (local.randomSeed == 0)
+            local.randomSeed = 1;
+        if (!options.initialColoring.empty())
+        {
+            local.initialColoring.resize(members.size());
+            for (size_t i = 0; i < members.size(); ++i)
+                local.initialColoring[i] = options.initialColoring[members[i]];
+        }
+
+        SolverResult part = Solver::run(sub, local);
+        if (!part.ok)
+        {
+            failed[k] = 1;
+            return;
+        }
+
+        int maxColor = 0;
+        for (size_t i = 0; i < members.size(); ++i)
+        {
+            result.coloring[members[i]] = part.coloring[i];
+            maxColor = std::max(maxColor, part.coloring[i]);
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+        solved[k] = {c, static_cast<int>(members.size()), maxColor, elapsed.count()};
+        sampleSizes[k] = part.rclSampleSize; });
+
+    // Uma componente sem solução (ex.: largura compacta insuficiente) invalida o todo
+    if (std::find(failed.begin(), failed.end(), 1) != failed.end())
+    {
+        result.ok = false;
+        result.coloring.clear();
+        return result;
+    }
+
+    if (!pending.empty())
+        result.rclSampleSize = sampleSizes.front();
+    if (stats)
+        *stats = std::move(solved);
+    if (workerStats)
+        *workerStats = scheduler.getStats();
+    return result;
+}
@@ -0,0 +1,72 @@
+#include "../include/ConstructionEngine.h"
+#include "../include/ColorKernel.h"
+#include "../include/CompressedDistance2.h"
+
+ConstructionState::ConstructionState(const Graph &g, int p, int q)
+    : graph(g), p_param(p), q_param(q), numColored(0)
+{
+    reset();
+}
+
+void ConstructionState::reset()
+{
+    int n = graph.getNumVertices();
+    coloring.assign(n, 0);
+    colored.assign(n, 0);
+    numColored = 0;
+}
+
+// Encontra a menor cor válida para o vértice v considerando a coloração atual.
+// As cores de N1 e N2 são reunidas em buffers contíguos e testadas pelo
+// kernel vetorial, que também salta direto para a próxima cor candidata.
+// Sem índice de distância 2, N2(v) vem do índice comprimido ou de uma cache
+// limitada calculada sob demanda.
+int ConstructionState::smallestValidColor(int v)
+{
+    const auto &nbrs = graph.getNeighbors(v);
+    std::vector<int> &g1 = workspace.gatherN1;
+    std::vector<int> &g2 = workspace.gatherN2;
+    if (g1.size() < nbrs.size())
+        g1.resize(nbrs.size());
+    for (size_t i = 0; i < nbrs.size(); ++i)
+        g1[i] = coloring[nbrs[i]];
+
+    // Índice comprimido: decodifica e reúne as cores numa só passada
+    const CompressedDistance2 *compressed = graph.getCompressedDistance2();
+    if (compressed)
+    {
+        size_t count = compressed->count(v);
+        if (g2.size() < count)
+            g2.resize(count);
+        compressed->gather(v, coloring.data(), g2.data());
+        return ColorKernel::smallestClearing(g1.data(), nbrs.size(), p_param,
+                                             g2.data(), count, q_param);
+    }
+
+    if (!graph.hasDistance2Index() && !distance2Cache)
+        distance2Cache.reset(new Distance2Cache(graph, Distance2Cache::getDefaultBudget()));
+    const auto &dist2 = distance2Cache ? distance2Cache->get(v) : graph.getDistance2Neighbors(v);
+    if (g2.size() < dist2.size())
+        g2.resize(dist2.size());
+    for (size_t i = 0; i < dist2.size(); ++i)
+        g2[i] = coloring[dist2[i]];
+
+    return ColorKernel::smallestClearing(g1.data(), nbrs.size(), p_param,
+                                         g2.data(), dist2.size(), q_param);
+}
+
+const std::vector<int> &ConstructionState::distance2Neighbors(int v)
+{
+    const CompressedDistance2 *compressed = graph.getCompressedDistance2();
+    if (compressed)
+    {
+        std::vector<int> &out = workspace.decodedN2;
+        out.clear();
+        compressed->forEach(v, [&out](int u)
+                            { out.push_back(u); });
+        return out;
+    }
+    if (!graph.hasDistance2Index() && !distance2Cache)
+        distance2Cache.reset(new Distance2Cache(graph, Distance2Cache::getDefaultBudget()));
+    return distance2Cache ? distance2Cache->get(v) : graph.getDistance2Neighbors(v);
+}
@@ -0,0 +1,11 @@
+#include "../include/DSaturAlgorithm.h"
+
+DSaturAlgorithm::DSaturAlgorithm(const Graph &g, int p, int q)
+    : engine(g, p, q)
+{
+}
+
+std::vector<int> DSaturAlgorithm::solve()
+{
+    return engine.construct();
+}
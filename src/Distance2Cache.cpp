@@ -0,0 +1,148 @@
+#include "../include/Distance2Cache.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+    std::atomic<size_t> defaultBudget(0);
+
+    std::mutex totalsMutex;
+    Distance2Cache::Metrics processTotals;
+}
+
+Distance2Cache::Distance2Cache(const Graph &g, size_t budgetBytes)
+    : graph(g), budget(budgetBytes), usedBytes(0), hand(0), stamp(0)
+{
+    const int n = graph.getNumVertices();
+    slices.resize(n);
+    resident.assign(n, 0);
+    referenced.assign(n, 0);
+    mark.assign(n, -1);
+    metrics.budgetBytes = budget;
+}
+
+Distance2Cache::~Distance2Cache()
+{
+    std::lock_guard<std::mutex> lock(totalsMutex);
+    processTotals.hits += metrics.hits;
+    processTotals.misses += metrics.misses;
+    processTotals.evictions += metrics.evictions;
+    processTotals.bypasses += metrics.bypasses;
+    processTotals.budgetBytes = std::max(processTotals.budgetBytes, metrics.budgetBytes);
+    processTotals.peakBytes = std::max(processTotals.peakBytes, metrics.peakBytes);
+}
+
+const std::vector<int> &Distance2Cache::get(int v)
+{
+    if (resident[v])
+    {
+        ++metrics.hits;
+        referenced[v] = 1;
+        return slices[v];
+    }
+
+    ++metrics.misses;
+    scan(v);
+    const size_t bytes = scratch.size() * sizeof(int);
+    if (bytes > budget)
+    {
+        ++metrics.bypasses;
+        return scratch;
+    }
+
+    evictFor(bytes);
+    slices[v].assign(scratch.begin(), scratch.end());
+    resident[v] = 1;
+    referenced[v] = 0;
+    ring.push_back(v);
+    usedBytes += bytes;
+    metrics.peakBytes = std::max(metrics.peakBytes, usedBytes);
+    return slices[v];
+}
+
+// Vizinhos dos vizinhos de v, excluindo v e N1(v), em scratch; ordenados
+// como as listas do índice, para que quem depende da ordem de N2 (ex.: os
+// baldes do smallest-last) tenha o mesmo resultado com qualquer fonte
+void Distance2Cache::scan(int v)
+{
+    if (++stamp == 0)
+    {
+        std::fill(mark.begin(), mark.end(), -1);
+        stamp = 1;
+    }
+    mark[v] = stamp;
+    const std::vector<int> &nbrs = graph.getNeighbors(v);
+    for (int u : nbrs)
+        mark[u] = stamp;
+
+    scratch.clear();
+    for (int u : nbrs)
+    {
+        for (int w : graph.getNeighbors(u))
+        {
+            if (mark[w] != stamp)
+            {
+                mark[w] = stamp;
+                scratch.push_back(w);
+            }
+        }
+    }
+    std::sort(scratch.begin(), scratch.end());
+}
+
+// Despeja fatias pela política CLOCK até que bytes caibam no orçamento
+void Distance2Cache::evictFor(size_t bytes)
+{
+    while (usedBytes + bytes > budget && !ring.empty())
+    {
+        if (hand >= ring.size())
+            hand = 0;
+        int victim = ring[hand];
+        if (referenced[victim])
+        {
+            referenced[victim] = 0;
+            ++hand;
+            continue;
+        }
+
+        usedBytes -= slices[victim].size() * sizeof(int);
+        std::vector<int>().swap(slices[victim]);
+        resident[victim] = 0;
+        ++metrics.evictions;
+
+        // O último da volta ocupa a posição liberada (examinado a seguir)
+        ring[hand] = ring.back();
+        ring.pop_back();
+    }
+}
+
+void Distance2Cache::setDefaultBudget(size_t bytes)
+{
+    defaultBudget.store(bytes);
+}
+
+size_t Distance2Cache::getDefaultBudget()
+{
+    return defaultBudget.load();
+}
+
+Distance2Cache::Metrics Distance2Cache::totals()
+{
+    std::lock_guard<std::mutex> lock(totalsMutex);
+    return processTotals;
+}
+
+void Distance2Cache::resetTotals()
+{
+    std::lock_guard<std::mutex> lock(totalsMutex);
+    processTotals = Metrics();
+}
+
+void Distance2Cache::printMetrics(const Metrics &m, std::ostream &out, const char *indent)
+{
+    out << indent << "Acertos: " << m.hits << ", faltas: " << m.misses << " (taxa de acerto "
+        << m.hitRate() * 100.0 << "%)" << std::endl;
+    out << indent << "Despejos: " << m.evictions << ", fatias maiores que o orçamento: " << m.bypasses << std::endl;
+    out << indent << "Ocupação máxima: " << m.peakBytes << " de " << m.budgetBytes << " bytes" << std::endl;
+}
@@ -0,0 +1,203 @@
+#include "../include/DynamicColoring.h"
+#include "../include/ColorKernel.h"
+#include "../include/VertexOrdering.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+DynamicColoring::DynamicColoring(Graph &g, int p, int q, const std::vector<int> &initial)
+    : graph(g), p_param(p), q_param(q), coloring(initial),
+      dirtyMark(g.getNumVertices(), 0), dirtyStamp(1), pendingChanges(0), pendingApplySeconds(0.0)
+{
+    coloring.resize(graph.getNumVertices(), 0);
+}
+
+void DynamicColoring::markDirty(int v)
+{
+    if (dirtyMark[v] != dirtyStamp)
+    {
+        dirtyMark[v] = dirtyStamp;
+        dirty.push_back(v);
+    }
+}
+
+// Uma nova aresta {u, v} só aproxima pares com extremidade em u ou v: os
+// candidatos a violação são u, v e seus vizinhos
+void DynamicColoring::addEdge(int u, int v)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    if (u != v && !graph.hasEdge(u, v))
+    {
+        graph.addEdge(u, v);
+        markDirty(u);
+        markDirty(v);
+        for (int x : graph.getNeighbors(u))
+            markDirty(x);
+        for (int x : graph.getNeighbors(v))
+            markDirty(x);
+    }
+    ++pendingChanges;
+    pendingApplySeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+// Remoções só afastam vértices: nenhuma restrição passa a ser violada
+void DynamicColoring::removeEdge(int u, int v)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    graph.removeEdge(u, v);
+    ++pendingChanges;
+    pendingApplySeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int DynamicColoring::addVertex()
+{
+    int v = graph.addVertex();
+    coloring.push_back(0);
+    dirtyMark.push_back(0);
+    markDirty(v);
+    ++pendingChanges;
+    return v;
+}
+
+void DynamicColoring::removeVertex(int v)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    graph.removeVertex(v);
+    ++pendingChanges;
+    pendingApplySeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+bool DynamicColoring::violates(int v) const
+{
+    int c = coloring[v];
+    if (c <= 0)
+        return true;
+    for (int u : graph.getNeighbors(v))
+    {
+        if (u != v && coloring[u] > 0 && std::abs(c - coloring[u]) < p_param)
+            return true;
+    }
+    for (int u : graph.getDistance2Neighbors(v))
+    {
+        if (coloring[u] > 0 && std::abs(c - coloring[u]) < q_param)
+            return true;
+    }
+    return false;
+}
+
+int DynamicColoring::smallestValidColor(int v)
+{
+    const auto &nbrs = graph.getNeighbors(v);
+    const auto &dist2 = graph.getDistance2Neighbors(v);
+    if (gatherN1.size() < nbrs.size())
+        gatherN1.resize(nbrs.size());
+    if (gatherN2.size() < dist2.size())
+        gatherN2.resize(dist2.size());
+
+    for (size_t i = 0; i < nbrs.size(); ++i)
+        gatherN1[i] = coloring[nbrs[i]];
+    for (size_t i = 0; i < dist2.size(); ++i)
+        gatherN2[i] = coloring[dist2[i]];
+
+    return ColorKernel::smallestClearing(gatherN1.data(), nbrs.size(), p_param,
+                                         gatherN2.data(), dist2.size(), q_param);
+}
+
+DynamicColoring::BatchStats DynamicColoring::repair()
+{
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Descolore os vértices em violação; o primeiro de cada par conflitante
+    // perde a cor e o outro deixa de violar
+    std::vector<int> recolor;
+    for (int v : dirty)
+    {
+        if (violates(v))
+        {
+            coloring[v] = 0;
+            recolor.push_back(v);
+        }
+    }
+
+    VertexOrdering::sortByDegree(graph, recolor);
+    for (int v : recolor)
+        coloring[v] = smallestValidColor(v);
+
+    BatchStats stats;
+    stats.changes = pendingChanges;
+    stats.checked = static_cast<int>(dirty.size());
+    stats.recolored = static_cast<int>(recolor.size());
+    stats.maxColor = coloring.empty() ? 0 : *std::max_element(coloring.begin(), coloring.end());
+    stats.applySeconds = pendingApplySeconds;
+    stats.repairSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    dirty.clear();
+    ++dirtyStamp;
+    pendingChanges = 0;
+    pendingApplySeconds = 0.0;
+    return stats;
+}
+
+bool DynamicColoring::applyChangeLog(const std::string &filename, std::vector<BatchStats> &stats)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        std::istringstream iss(line);
+        std::string op;
+        if (!(iss >> op) || op[0] == '#')
+            continue;
+
+        int u = -1, v = -1;
+        int n = graph.getNumVertices();
+        bool ok = true;
+        if (op == "commit")
+        {
+            stats.push_back(repair());
+        }
+        else if (op == "+" || op == "-")
+        {
+            ok = static_cast<bool>(iss >> u >> v) && u >= 0 && u < n && v >= 0 && v < n;
+            if (ok && op == "+")
+                addEdge(u, v);
+            else if (ok)
+                removeEdge(u, v);
+        }
+        else if (op == "+v")
+        {
+            addVertex();
+        }
+        else if (op == "-v")
+        {
+            ok = static_cast<bool>(iss >> u) && u >= 0 && u < n;
+            if (ok)
+                removeVertex(u);
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (!ok)
+        {
+            std::cerr << "Erro: linha " << lineNumber << " inválida em " << filename << ": " << line << std::endl;
+            return false;
+        }
+    }
+
+    if (pendingChanges > 0)
+        stats.push_back(repair());
+    return true;
+}
@@ -0,0 +1,62 @@
+#include "../include/ElitePool.h"
+#include <algorithm>
+#include <climits>
+
+ElitePool::ElitePool(int capacity, int minDistance)
+    : capacity(std::max(1, capacity)), minDistance(std::max(0, minDistance))
+{
+}
+
+int ElitePool::distance(const std::vector<int> &a, const std::vector<int> &b)
+{
+    size_t n = std::min(a.size(), b.size());
+    int diff = static_cast<int>(std::max(a.size(), b.size()) - n);
+    const int *pa = a.data();
+    const int *pb = b.data();
+    for (size_t i = 0; i < n; ++i)
+    {
+        diff += (pa[i] != pb[i]);
+    }
+    return diff;
+}
+
+bool ElitePool::tryInsert(const std::vector<int> &coloring, int maxColor)
+{
+    int bestMax = INT_MAX, worstMax = INT_MIN;
+    int closest = -1, closestDistance = INT_MAX;
+    bool diverse = true;
+
+    for (int i = 0; i < size(); ++i)
+    {
+        bestMax = std::min(bestMax, entries[i].maxColor);
+        worstMax = std::max(worstMax, entries[i].maxColor);
+
+        int d = distance(coloring, entries[i].coloring);
+        if (d == 0)
+            return false; // já está no conjunto
+        if (d < minDistance)
+            diverse = false;
+
+        // Candidato a substituição: o mais parecido entre os não melhores
+        if (entries[i].maxColor >= maxColor && d < closestDistance)
+        {
+            closestDistance = d;
+            closest = i;
+        }
+    }
+
+    if (size() < capacity)
+    {
+        if (!diverse && maxColor >= bestMax)
+            return false;
+        entries.push_back({coloring, maxColor});
+        return true;
+    }
+
+    bool accept = maxColor < bestMax || (maxColor < worstMax && diverse);
+    if (!accept || closest < 0)
+        return false;
+
+    entries[closest] = {coloring, maxColor};
+    return true;
+}
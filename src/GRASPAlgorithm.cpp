@@ -1,144 +1,244 @@
 #include "../include/GRASPAlgorithm.h"
+#include "../include/ElitePool.h"
+#include "../include/PathRelinking.h"
+#include "../include/Config.h"
 #include <algorithm>
-#include <cstdlib>
+#include <atomic>
 #include <climits>
+#include <cstdint>
+#include <cstdlib>
 
 GRASPAlgorithm::GRASPAlgorithm(const Graph &g, int p, int q, double alpha, int iterations)
-    : graph(g), p_param(p), q_param(q), alpha(alpha), iterations(iterations < 30 ? 30 : iterations), averageSolution(0.0)
+    : graph(g), p_param(p), q_param(q), alpha(alpha), iterations(iterations < 30 ? 30 : iterations), averageSolution(0.0),
+      iterationsExecuted(0), lowerBound(0), eliteSize(0), relinkImprovements(0),
+      incumbent(nullptr), numThreads(1), hasLocalSeed(false), localSeed(0),
+      engine(g, p, q, RCLSelection(alpha))
 {
 }
 
-// Encontra a menor cor válida para o vértice v considerando a coloração atual
-int GRASPAlgorithm::findSmallestValidColor(int v, const std::vector<int> &coloring)
+// Executa o GRASP por várias iterações e retorna a melhor solução
+std::vector<int> GRASPAlgorithm::solve()
 {
-    int color = 1;
-    while (true)
+    if (numThreads > 1 && eliteSize == 0)
+        return solveParallel();
+
+    std::vector<int> bestColoring;
+    int bestMaxColor = INT_MAX;
+    double sumSolutions = 0.0;
+    int completed = 0;
+    iterationsExecuted = 0;
+    relinkImprovements = 0;
+
+    ElitePool pool(eliteSize, static_cast<int>(Config::ELITE_MIN_DISTANCE_FRACTION * graph.getNumVertices()));
+    PathRelinking relinker(graph, p_param, q_param);
+
+    // Buffer reutilizado entre iterações (sem alocação em regime permanente)
+    std::vector<int> coloring;
+    coloring.reserve(graph.getNumVertices());
+    bestColoring.reserve(graph.getNumVertices());
+
+    // Partida a quente: a solução inicial só é substituída por uma melhor
+    if (!initialSolution.empty())
     {
-        bool ok = true;
+        bestColoring = initialSolution;
+        bestMaxColor = *std::max_element(initialSolution.begin(), initialSolution.end());
+        if (eliteSize > 0)
+            pool.tryInsert(initialSolution, bestMaxColor);
+        if (incumbent)
+            incumbent->publish(bestMaxColor);
+    }
+
+    for (int iter = 0; iter < iterations; ++iter)
+    {
+        if (incumbent && incumbent->shouldStop())
+            break;
+        ++iterationsExecuted;
 
-        // Verificar vizinhos (distância 1)
-        const auto &nbrs = graph.getNeighbors(v);
-        for (int u : nbrs)
+        // Com incumbente compartilhado (e sem religamento, que pode melhorar
+        // uma construção ruim), construções que atingem a melhor maior cor
+        // conhecida são abandonadas
+        if (incumbent && eliteSize == 0)
         {
-            if (coloring[u] == 0)
+            if (!engine.constructBelow(std::min(bestMaxColor, incumbent->getBestSpan())))
                 continue;
-            if (std::abs(color - coloring[u]) < p_param)
-            {
-                ok = false;
-                break;
-            }
         }
+        else
+        {
+            engine.construct();
+        }
+        const std::vector<int> &constructed = engine.current();
+        coloring.assign(constructed.begin(), constructed.end());
 
-        if (!ok)
+        // Calcular a maior cor usada
+        int maxColor = 0;
+        for (int c : coloring)
         {
-            ++color;
-            continue;
+            maxColor = std::max(maxColor, c);
         }
 
-        // Verificar distância 2
-        auto dist2 = graph.getVerticesAtDistance2(v);
-        for (int u : dist2)
+        // Religamento com um membro do conjunto elite
+        if (eliteSize > 0)
         {
-            if (coloring[u] == 0)
-                continue;
-            if (std::abs(color - coloring[u]) < q_param)
+            int relinkedMax = relinker.relinkWithPool(coloring, maxColor, pool, engine.rng());
+            if (relinkedMax < maxColor)
             {
-                ok = false;
-                break;
+                maxColor = relinkedMax;
+                ++relinkImprovements;
             }
+            pool.tryInsert(coloring, maxColor);
         }
 
-        if (ok)
+        sumSolutions += maxColor;
+        ++completed;
+
+        // Atualizar melhor solução se encontrou uma melhor
+        if (maxColor < bestMaxColor)
+        {
+            bestMaxColor = maxColor;
+            bestColoring = coloring;
+            if (incumbent)
+                incumbent->publish(bestMaxColor);
+        }
+
+        // Limite inferior atingido: nenhuma iteração pode melhorar a solução
+        if (lowerBound > 0 && bestMaxColor <= lowerBound)
             break;
-        ++color;
     }
-    return color;
+
+    averageSolution = completed > 0 ? sumSolutions / static_cast<double>(completed) : -1.0;
+
+    return bestColoring;
 }
 
-// solução usando heurística gulosa randomizada
-std::vector<int> GRASPAlgorithm::constructGreedyRandomized()
+// Versão paralela: cada iteração é uma tarefa do escalonador com roubo de
+// trabalho, com gerador semeado por (semente base, índice da iteração); cada
+// worker guarda sua melhor solução e o empate é resolvido pela iteração mais
+// antiga. Ao atingir o limite inferior, só são descartadas as iterações
+// posteriores à primeira que o atingiu; as anteriores são todas executadas,
+// então resultado, média e iterações executadas não dependem do número de
+// threads nem do escalonamento (exceto com incumbente compartilhado, cuja
+// parada vem de fora).
+std::vector<int> GRASPAlgorithm::solveParallel()
 {
-    int n = graph.getNumVertices();
-    std::vector<int> coloring(n, 0);
-    std::vector<bool> colored(n, false);
+    using ParallelEngine = ConstructionEngine<RCLSelection, MersenneRng, LowestIdTieBreak>;
 
-    for (int count = 0; count < n; ++count)
+    struct WorkerBest
     {
-        // Para cada vértice não colorido, calcular a menor cor válida
-        std::vector<std::pair<int, int>> candidates; // (cor_minima, vertice)
+        int maxColor = INT_MAX;
+        int iteration = INT_MAX;
+        std::vector<int> coloring;
+    };
+
+    const unsigned int baseSeed = hasLocalSeed ? localSeed : static_cast<unsigned int>(std::rand());
+    const RCLSelection &serialSelection = engine.selection();
+
+    WorkStealingScheduler scheduler(numThreads);
+    std::vector<ParallelEngine> engines;
+    engines.reserve(numThreads);
+    for (int t = 0; t < numThreads; ++t)
+    {
+        engines.emplace_back(graph, p_param, q_param, serialSelection);
+    }
+    std::vector<WorkerBest> bests(numThreads);
 
-        for (int v = 0; v < n; ++v)
+    std::vector<int> bestColoring;
+    int bestMaxColor = INT_MAX;
+    if (!initialSolution.empty())
+    {
+        bestColoring = initialSolution;
+        bestMaxColor = *std::max_element(initialSolution.begin(), initialSolution.end());
+        if (incumbent)
+            incumbent->publish(bestMaxColor);
+    }
+
+    // Maior cor de cada iteração (0 = não executada ou abandonada)
+    std::vector<int> results(iterations, 0);
+    std::vector<uint8_t> executed(iterations, 0);
+    // Menor iteração que atingiu o limite inferior (INT_MAX = nenhuma)
+    std::atomic<int> boundIteration(INT_MAX);
+
+    scheduler.parallelFor(0, iterations, [&](int iter, int t)
+                          {
+        if (iter > boundIteration.load(std::memory_order_relaxed) || (incumbent && incumbent->shouldStop()))
+            return;
+        executed[iter] = 1;
+
+        ParallelEngine &eng = engines[t];
+        eng.rng().seed(baseSeed + 0x9E3779B9u * static_cast<unsigned int>(iter + 1));
+        if (incumbent)
         {
-            if (colored[v])
-                continue;
-            int minColor = findSmallestValidColor(v, coloring);
-            candidates.emplace_back(minColor, v);
+            if (!eng.constructBelow(std::min(bestMaxColor, incumbent->getBestSpan())))
+                return;
         }
+        else
+        {
+            eng.construct();
+        }
+        const std::vector<int> &constructed = eng.current();
+        int maxColor = *std::max_element(constructed.begin(), constructed.end());
+        results[iter] = maxColor;
 
-        if (candidates.empty())
-            break;
-
-        // Encontrar cMin e cMax entre os candidatos
-        int cMin = INT_MAX, cMax = INT_MIN;
-        for (const auto &c : candidates)
+        WorkerBest &best = bests[t];
+        if (maxColor < best.maxColor || (maxColor == best.maxColor && iter < best.iteration))
         {
-            cMin = std::min(cMin, c.first);
-            cMax = std::max(cMax, c.first);
+            best.maxColor = maxColor;
+            best.iteration = iter;
+            best.coloring.assign(constructed.begin(), constructed.end());
+            if (incumbent)
+                incumbent->publish(maxColor);
         }
 
-        // Construir RCL (Restricted Candidate List)
-        // Um candidato entra na RCL se cor <= cMin + alpha * (cMax - cMin)
-        double threshold = cMin + alpha * (cMax - cMin);
-        std::vector<std::pair<int, int>> rcl;
-        for (const auto &c : candidates)
+        if (lowerBound > 0 && maxColor <= lowerBound)
         {
-            if (c.first <= threshold)
+            int current = boundIteration.load(std::memory_order_relaxed);
+            while (iter < current && !boundIteration.compare_exchange_weak(current, iter, std::memory_order_relaxed))
             {
-                rcl.push_back(c);
             }
-        }
+        } });
 
-        // Escolher aleatoriamente um candidato da RCL
-        int idx = std::rand() % rcl.size();
-        int chosenVertex = rcl[idx].second;
-        int chosenColor = rcl[idx].first;
+    // Iterações após a primeira que atingiu o limite podem ou não ter rodado: são ignoradas
+    const int lastIteration = std::min(iterations - 1, boundIteration.load());
 
-        coloring[chosenVertex] = chosenColor;
-        colored[chosenVertex] = true;
-    }
-
-    return coloring;
-}
-
-// Executa o GRASP por várias iterações e retorna a melhor solução
-std::vector<int> GRASPAlgorithm::solve()
-{
-    std::vector<int> bestColoring;
-    int bestMaxColor = INT_MAX;
-    double sumSolutions = 0.0;
-
-    for (int iter = 0; iter < iterations; ++iter)
+    // A solução inicial vence empates (iteração -1)
+    int bestIteration = bestColoring.empty() ? INT_MAX : -1;
+    for (const WorkerBest &best : bests)
     {
-        std::vector<int> coloring = constructGreedyRandomized();
-
-        // Calcular a maior cor usada
-        int maxColor = 0;
-        for (int c : coloring)
+        if (best.iteration > lastIteration)
+            continue;
+        if (best.maxColor < bestMaxColor || (best.maxColor == bestMaxColor && best.iteration < bestIteration))
         {
-            maxColor = std::max(maxColor, c);
+            bestMaxColor = best.maxColor;
+            bestIteration = best.iteration;
+            bestColoring = best.coloring;
         }
+    }
 
-        sumSolutions += maxColor;
-
-        // Atualizar melhor solução se encontrou uma melhor
-        if (maxColor < bestMaxColor)
+    double sumSolutions = 0.0;
+    int completed = 0;
+    iterationsExecuted = 0;
+    for (int iter = 0; iter <= lastIteration; ++iter)
+    {
+        iterationsExecuted += executed[iter];
+        if (results[iter] > 0)
         {
-            bestMaxColor = maxColor;
-            bestColoring = coloring;
+            sumSolutions += results[iter];
+            ++completed;
         }
     }
-
-    averageSolution = sumSolutions / static_cast<double>(iterations);
+    relinkImprovements = 0;
+    averageSolution = completed > 0 ? sumSolutions / static_cast<double>(completed) : -1.0;
+    schedulerStats = scheduler.getStats();
 
     return bestColoring;
 }
+
+void GRASPAlgorithm::setRCLSample(int size, double fraction)
+{
+    engine.selection().setSample(size, fraction);
+}
+
+int GRASPAlgorithm::getRCLSampleSize() const
+{
+    const RCLSelection &selection = engine.selection();
+    return selection.isSampled() ? selection.effectiveSampleSize(graph.getNumVertices()) : 0;
+}
@@ -1,10 +1,11 @@
 #include "../include/Graph.h"
-#include <queue>
+#include "../include/BFSEngine.h"
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 Graph::Graph(int n, bool isDirected)
-    : numVertices(n), directed(isDirected)
+    : numVertices(n), directed(isDirected), distance2Built(false), distance2Stamp(0)
 {
     adjList.resize(n);
     vertexWeights.resize(n, 0);
@@ -26,6 +27,11 @@ void Graph::addEdge(int u, int v, int weight)
         throw std::out_of_range("Vértice fora do intervalo válido");
     }
 
+    compressedDistance2.reset();
+
+    // Aresta repetida não altera as distâncias
+    bool isNew = distance2Built && u != v && !hasEdge(u, v);
+
     adjList[u].push_back(v);
     if (!directed)
     {
@@ -33,62 +39,198 @@ void Graph::addEdge(int u, int v, int weight)
     }
 
     edgeWeights[getEdgeKey(u, v)] = weight;
+
+    if (distance2Built && directed)
+    {
+        distance2Lists.clear();
+        distance2Built = false;
+    }
+    else if (isNew)
+    {
+        indexEdgeAdded(u, v);
+    }
 }
 
-void Graph::setVertexWeight(int v, int weight)
+bool Graph::removeEdge(int u, int v)
 {
-    if (!isValidVertex(v))
+    if (!isValidVertex(u) || !isValidVertex(v))
     {
         throw std::out_of_range("Vértice fora do intervalo válido");
     }
-    vertexWeights[v] = weight;
+    if (!hasEdge(u, v))
+        return false;
+    compressedDistance2.reset();
+
+    adjList[u].erase(std::remove(adjList[u].begin(), adjList[u].end(), v), adjList[u].end());
+    if (!directed)
+    {
+        adjList[v].erase(std::remove(adjList[v].begin(), adjList[v].end(), u), adjList[v].end());
+    }
+    edgeWeights.erase(getEdgeKey(u, v));
+
+    if (distance2Built && directed)
+    {
+        distance2Lists.clear();
+        distance2Built = false;
+    }
+    else if (distance2Built && u != v)
+    {
+        indexEdgeRemoved(u, v);
+    }
+    return true;
 }
 
-const std::vector<int> &Graph::getNeighbors(int v) const
+bool Graph::hasEdge(int u, int v) const
+{
+    if (!isValidVertex(u) || !isValidVertex(v))
+        return false;
+    // Procura na lista menor
+    if (!directed && adjList[v].size() < adjList[u].size())
+        std::swap(u, v);
+    return std::find(adjList[u].begin(), adjList[u].end(), v) != adjList[u].end();
+}
+
+int Graph::addVertex()
+{
+    adjList.emplace_back();
+    vertexWeights.push_back(0);
+    compressedDistance2.reset();
+    if (distance2Built)
+        distance2Lists.emplace_back();
+    return numVertices++;
+}
+
+void Graph::removeVertex(int v)
 {
     if (!isValidVertex(v))
     {
         throw std::out_of_range("Vértice fora do intervalo válido");
     }
-    return adjList[v];
+    while (!adjList[v].empty())
+    {
+        removeEdge(v, adjList[v].back());
+    }
 }
 
-int Graph::distance(int u, int v) const
+// Marca N(v) com um novo carimbo e o devolve
+int Graph::markNeighbors(int v)
 {
-    if (!isValidVertex(u) || !isValidVertex(v))
+    if (static_cast<int>(distance2Mark.size()) < numVertices)
+        distance2Mark.resize(numVertices, -1);
+    int stamp = ++distance2Stamp;
+    for (int x : adjList[v])
+        distance2Mark[x] = stamp;
+    return stamp;
+}
+
+// Insere/remove o par {a, b} nas listas ordenadas de distância 2
+void Graph::linkDistance2(int a, int b)
+{
+    for (int k = 0; k < 2; ++k)
     {
-        return -1;
+        std::vector<int> &list = distance2Lists[a];
+        auto it = std::lower_bound(list.begin(), list.end(), b);
+        if (it == list.end() || *it != b)
+            list.insert(it, b);
+        std::swap(a, b);
     }
+}
 
-    if (u == v)
-        return 0;
-
-    std::vector<int> dist(numVertices, -1);
-    std::queue<int> q;
+void Graph::unlinkDistance2(int a, int b)
+{
+    for (int k = 0; k < 2; ++k)
+    {
+        std::vector<int> &list = distance2Lists[a];
+        auto it = std::lower_bound(list.begin(), list.end(), b);
+        if (it != list.end() && *it == b)
+            list.erase(it);
+        std::swap(a, b);
+    }
+}
 
-    dist[u] = 0;
-    q.push(u);
+// Uma nova aresta {u, v} só cria caminhos de comprimento 2 da forma
+// a-u-v ou u-v-b; o par {u, v} deixa de estar a distância 2
+void Graph::indexEdgeAdded(int u, int v)
+{
+    unlinkDistance2(u, v);
+    for (int k = 0; k < 2; ++k)
+    {
+        int stamp = markNeighbors(v);
+        for (int a : adjList[u])
+        {
+            if (a != v && a != u && distance2Mark[a] != stamp)
+                linkDistance2(a, v);
+        }
+        std::swap(u, v);
+    }
+}
 
-    while (!q.empty())
+// Após remover {u, v}, cada par {a, v} com a em N(u) continua a distância 2
+// apenas se ainda houver um vizinho comum; {u, v} passa a distância 2 se houver
+void Graph::indexEdgeRemoved(int u, int v)
+{
+    for (int k = 0; k < 2; ++k)
     {
-        int current = q.front();
-        q.pop();
+        int stamp = markNeighbors(v);
+        for (int a : adjList[u])
+        {
+            if (a == v || a == u || distance2Mark[a] == stamp)
+                continue;
+            bool common = false;
+            for (int w : adjList[a])
+            {
+                if (distance2Mark[w] == stamp)
+                {
+                    common = true;
+                    break;
+                }
+            }
+            if (!common)
+                unlinkDistance2(a, v);
+        }
 
-        for (int neighbor : adjList[current])
+        if (k == 0)
         {
-            if (dist[neighbor] == -1)
+            bool common = false;
+            for (int w : adjList[u])
             {
-                dist[neighbor] = dist[current] + 1;
-                if (neighbor == v)
+                if (distance2Mark[w] == stamp)
                 {
-                    return dist[v];
+                    common = true;
+                    break;
                 }
-                q.push(neighbor);
             }
+            if (common)
+                linkDistance2(u, v);
         }
+        std::swap(u, v);
     }
+}
 
-    return dist[v];
+void Graph::setVertexWeight(int v, int weight)
+{
+    if (!isValidVertex(v))
+    {
+        throw std::out_of_range("Vértice fora do intervalo válido");
+    }
+    vertexWeights[v] = weight;
+}
+
+const std::vector<int> &Graph::getNeighbors(int v) const
+{
+    if (!isValidVertex(v))
+    {
+        throw std::out_of_range("Vértice fora do intervalo válido");
+    }
+    return adjList[v];
+}
+
+int Graph::distance(int u, int v) const
+{
+    // Um motor por thread, reaproveitado entre chamadas (sem alocação por consulta)
+    thread_local BFSEngine engine(*this);
+    engine.attach(*this);
+    return engine.distance(u, v);
 }
 
 std::unordered_set<int> Graph::getVerticesAtDistance2(int v) const
@@ -124,6 +266,78 @@ std::unordered_set<int> Graph::getVerticesAtDistance2(int v) const
     return result;
 }
 
+// Recalcula a lista ordenada de vértices a distância exatamente 2 de v;
+// mark[x] == stamp indica que x já foi visto (distância 0, 1 ou 2)
+void Graph::computeDistance2List(int v, std::vector<int> &mark, int stamp)
+{
+    mark[v] = stamp;
+    for (int neighbor1 : adjList[v])
+    {
+        mark[neighbor1] = stamp;
+    }
+
+    std::vector<int> &result = distance2Lists[v];
+    result.clear();
+    for (int neighbor1 : adjList[v])
+    {
+        for (int neighbor2 : adjList[neighbor1])
+        {
+            if (mark[neighbor2] != stamp)
+            {
+                mark[neighbor2] = stamp;
+                result.push_back(neighbor2);
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+}
+
+void Graph::buildDistance2Index()
+{
+    compressedDistance2.reset();
+    distance2Lists.assign(numVertices, {});
+
+    std::vector<int> mark(numVertices, -1);
+    for (int v = 0; v < numVertices; ++v)
+    {
+        computeDistance2List(v, mark, v);
+        distance2Lists[v].shrink_to_fit();
+    }
+
+    distance2Built = true;
+}
+
+void Graph::setDistance2Index(std::vector<std::vector<int>> lists)
+{
+    if (static_cast<int>(lists.size()) != numVertices)
+    {
+        throw std::invalid_argument("Índice de distância 2 com tamanho diferente do grafo");
+    }
+    distance2Lists = std::move(lists);
+    distance2Built = true;
+    compressedDistance2.reset();
+}
+
+void Graph::setCompressedDistance2Index(std::shared_ptr<const CompressedDistance2> index)
+{
+    std::vector<std::vector<int>>().swap(distance2Lists);
+    distance2Built = false;
+    compressedDistance2 = std::move(index);
+}
+
+const std::vector<int> &Graph::getDistance2Neighbors(int v) const
+{
+    if (!isValidVertex(v))
+    {
+        throw std::out_of_range("Vértice fora do intervalo válido");
+    }
+    if (!distance2Built)
+    {
+        throw std::logic_error("Índice de distância 2 não construído");
+    }
+    return distance2Lists[v];
+}
+
 int Graph::getDegree(int v) const
 {
     if (v < 0 || v >= numVertices)
@@ -138,5 +352,9 @@ void Graph::clear()
     adjList.clear();
     vertexWeights.clear();
     edgeWeights.clear();
+    distance2Lists.clear();
+    distance2Built = false;
+    compressedDistance2.reset();
+    distance2Mark.clear();
     numVertices = 0;
 }
@@ -0,0 +1,108 @@
+#include "../include/GraphCache.h"
+#include "../include/InputReader.h"
+#include <chrono>
+#include <sys/stat.h>
+
+GraphCache::GraphCache(size_t cap)
+    : capacity(cap > 0 ? cap : 1), hits(0), misses(0)
+{
+}
+
+GraphCache::Entry GraphCache::load(const std::string &filename)
+{
+    Entry entry;
+    auto graph = std::make_shared<Graph>();
+
+    auto loadStart = std::chrono::high_resolution_clock::now();
+    if (!InputReader::readGraphAuto(filename, *graph))
+        return entry;
+    auto indexStart = std::chrono::high_resolution_clock::now();
+    graph->buildDistance2Index();
+    auto indexEnd = std::chrono::high_resolution_clock::now();
+
+    entry.loadSeconds = std::chrono::duration<double>(indexStart - loadStart).count();
+    entry.indexSeconds = std::chrono::duration<double>(indexEnd - indexStart).count();
+    entry.graph = graph;
+    return entry;
+}
+
+GraphCache::Entry GraphCache::get(const std::string &filename, bool &hit, std::string &error)
+{
+    struct stat info;
+    if (::stat(filename.c_str(), &info) != 0)
+    {
+        error = "arquivo não encontrado: " + filename;
+        hit = false;
+        return Entry();
+    }
+    const std::string key = filename + '\n' + std::to_string(static_cast<long long>(info.st_mtime)) +
+                            '\n' + std::to_string(static_cast<long long>(info.st_size));
+
+    std::promise<Entry> promise;
+    std::shared_future<Entry> future;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = slots.find(key);
+        hit = it != slots.end();
+        if (hit)
+        {
+            ++hits;
+            order.splice(order.begin(), order, it->second.position);
+            future = it->second.entry;
+        }
+        else
+        {
+            ++misses;
+            future = promise.get_future().share();
+            order.push_front(key);
+            slots[key] = {future, order.begin()};
+
+            // Quem ainda espera um grafo removido continua com sua cópia do future
+            while (slots.size() > capacity)
+            {
+                slots.erase(order.back());
+                order.pop_back();
+            }
+        }
+    }
+
+    if (!hit)
+    {
+        Entry loaded = load(filename);
+        promise.set_value(loaded);
+        if (!loaded.graph)
+        {
+            // Falhas não ficam no cache: a próxima requisição tenta de novo
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = slots.find(key);
+            if (it != slots.end())
+            {
+                order.erase(it->second.position);
+                slots.erase(it);
+            }
+        }
+    }
+
+    Entry entry = future.get();
+    if (!entry.graph)
+        error = "não foi possível ler o grafo: " + filename;
+    return entry;
+}
+
+size_t GraphCache::getHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+size_t GraphCache::getMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+size_t GraphCache::getSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return slots.size();
+}
@@ -0,0 +1,404 @@
+#include "../include/GraphGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+    constexpr uint32_t BINARY_VERSION = 1;
+    constexpr size_t WRITE_BUFFER_SIZE = 1 << 20;
+    constexpr int COUNT_FIELD_WIDTH = 20; // dígitos do total de arestas no DIMACS
+
+    void putU32(std::vector<char> &buf, uint32_t x)
+    {
+        for (int i = 0; i < 4; ++i)
+            buf.push_back(static_cast<char>((x >> (8 * i)) & 0xFF));
+    }
+
+    void putU64(std::vector<char> &buf, uint64_t x)
+    {
+        for (int i = 0; i < 8; ++i)
+            buf.push_back(static_cast<char>((x >> (8 * i)) & 0xFF));
+    }
+}
+
+EdgeStreamWriter::EdgeStreamWriter(const std::string &filename, Format fmt)
+    : file(std::fopen(filename.c_str(), "wb")), format(fmt), numEdges(0), countOffset(0)
+{
+    buffer.reserve(WRITE_BUFFER_SIZE + 64);
+}
+
+EdgeStreamWriter::~EdgeStreamWriter()
+{
+    if (file)
+        std::fclose(file);
+}
+
+void EdgeStreamWriter::begin(int n, const std::string &comment)
+{
+    if (format == Format::Binary)
+    {
+        std::fwrite("LPQB", 1, 4, file);
+        buffer.clear();
+        putU32(buffer, BINARY_VERSION);
+        putU32(buffer, static_cast<uint32_t>(n));
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        countOffset = std::ftell(file);
+        buffer.clear();
+        putU64(buffer, 0);
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+    }
+    else
+    {
+        std::fprintf(file, "c %s\n", comment.c_str());
+        std::fprintf(file, "p edge %d ", n);
+        countOffset = std::ftell(file);
+        std::fprintf(file, "%*d\n", COUNT_FIELD_WIDTH, 0);
+    }
+    buffer.clear();
+}
+
+void EdgeStreamWriter::edge(int u, int v)
+{
+    if (format == Format::Binary)
+    {
+        putU32(buffer, static_cast<uint32_t>(u));
+        putU32(buffer, static_cast<uint32_t>(v));
+    }
+    else
+    {
+        char line[32];
+        int len = std::snprintf(line, sizeof(line), "e %d %d\n", u + 1, v + 1);
+        buffer.insert(buffer.end(), line, line + len);
+    }
+    ++numEdges;
+
+    if (buffer.size() >= WRITE_BUFFER_SIZE)
+    {
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+}
+
+bool EdgeStreamWriter::finish()
+{
+    if (!file)
+        return false;
+
+    std::fwrite(buffer.data(), 1, buffer.size(), file);
+    buffer.clear();
+
+    // Preenche o total de arestas no cabeçalho
+    std::fseek(file, countOffset, SEEK_SET);
+    if (format == Format::Binary)
+    {
+        putU64(buffer, numEdges);
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+    }
+    else
+    {
+        std::fprintf(file, "%*llu", COUNT_FIELD_WIDTH, static_cast<unsigned long long>(numEdges));
+    }
+
+    bool ok = !std::ferror(file);
+    ok = (std::fclose(file) == 0) && ok;
+    file = nullptr;
+    return ok;
+}
+
+void GraphGenerator::gnp(EdgeStreamWriter &out, int n, double p, uint64_t seed)
+{
+    if (p <= 0.0 || n < 2)
+        return;
+
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    if (p >= 1.0)
+    {
+        for (int v = 1; v < n; ++v)
+            for (int w = 0; w < v; ++w)
+                out.edge(w, v);
+        return;
+    }
+
+    // Batagelj & Brandes: salta diretamente para o próximo par sorteado
+    double logq = std::log(1.0 - p);
+    long long v = 1, w = -1;
+    while (v < n)
+    {
+        double r = unit(gen);
+        w += 1 + static_cast<long long>(std::floor(std::log(1.0 - r) / logq));
+        while (w >= v && v < n)
+        {
+            w -= v;
+            ++v;
+        }
+        if (v < n)
+            out.edge(static_cast<int>(w), static_cast<int>(v));
+    }
+}
+
+void GraphGenerator::samplePoints(int n, uint64_t seed, std::vector<double> &xs, std::vector<double> &ys)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    xs.resize(n);
+    ys.resize(n);
+    for (int i = 0; i < n; ++i)
+    {
+        xs[i] = unit(gen);
+        ys[i] = unit(gen);
+    }
+}
+
+void GraphGenerator::geometric(EdgeStreamWriter &out, int n, double radius, uint64_t seed)
+{
+    if (n < 2 || radius <= 0.0)
+        return;
+
+    std::vector<double> xs, ys;
+    samplePoints(n, seed, xs, ys);
+
+    // Grade de células de lado >= radius (no máximo ~n células)
+    int cellsPerSide = std::max(1, static_cast<int>(std::min(1.0 / radius, std::sqrt(static_cast<double>(n)))));
+    auto cellOf = [cellsPerSide](double x) {
+        return std::min(cellsPerSide - 1, static_cast<int>(x * cellsPerSide));
+    };
+
+    // Ordenação por contagem: pontos agrupados por célula
+    size_t numCells = static_cast<size_t>(cellsPerSide) * cellsPerSide;
+    std::vector<int> cellStart(numCells + 1, 0);
+    std::vector<int> cellOfPoint(n);
+    for (int i = 0; i < n; ++i)
+    {
+        cellOfPoint[i] = cellOf(ys[i]) * cellsPerSide + cellOf(xs[i]);
+        ++cellStart[cellOfPoint[i] + 1];
+    }
+    for (size_t c = 0; c < numCells; ++c)
+        cellStart[c + 1] += cellStart[c];
+    std::vector<int> points(n);
+    {
+        std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+        for (int i = 0; i < n; ++i)
+            points[fill[cellOfPoint[i]]++] = i;
+    }
+    cellOfPoint.clear();
+    cellOfPoint.shrink_to_fit();
+
+    double r2 = radius * radius;
+    for (int cy = 0; cy < cellsPerSide; ++cy)
+    {
+        for (int cx = 0; cx < cellsPerSide; ++cx)
+        {
+            size_t c = static_cast<size_t>(cy) * cellsPerSide + cx;
+            for (int a = cellStart[c]; a < cellStart[c + 1]; ++a)
+            {
+                int u = points[a];
+                // Vizinhas "à frente" (a própria célula e 4 das 8 ao redor) para gerar cada par uma vez
+                static const int dx[] = {0, 1, -1, 0, 1};
+                static const int dy[] = {0, 0, 1, 1, 1};
+                for (int k = 0; k < 5; ++k)
+                {
+                    int nx = cx + dx[k], ny = cy + dy[k];
+                    if (nx < 0 || nx >= cellsPerSide || ny >= cellsPerSide)
+                        continue;
+                    size_t d = static_cast<size_t>(ny) * cellsPerSide + nx;
+                    int bStart = (k == 0) ? a + 1 : cellStart[d];
+                    for (int b = bStart; b < cellStart[d + 1]; ++b)
+                    {
+                        int v = points[b];
+                        double ddx = xs[u] - xs[v], ddy = ys[u] - ys[v];
+                        if (ddx * ddx + ddy * ddy <= r2)
+                            out.edge(std::min(u, v), std::max(u, v));
+                    }
+                }
+            }
+        }
+    }
+}
+
+void GraphGenerator::dsjr(EdgeStreamWriter &out, int n, double radius, bool complement, uint64_t seed)
+{
+    if (!complement)
+    {
+        geometric(out, n, radius, seed);
+        return;
+    }
+
+    // Complemento: todos os pares a distância > radius (grafo denso, O(n²))
+    std::vector<double> xs, ys;
+    samplePoints(n, seed, xs, ys);
+    double r2 = radius * radius;
+    for (int v = 1; v < n; ++v)
+    {
+        for (int u = 0; u < v; ++u)
+        {
+            double ddx = xs[u] - xs[v], ddy = ys[u] - ys[v];
+            if (ddx * ddx + ddy * ddy > r2)
+                out.edge(u, v);
+        }
+    }
+}
+
+void GraphGenerator::grid(EdgeStreamWriter &out, int rows, int cols)
+{
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            int v = r * cols + c;
+            if (c + 1 < cols)
+                out.edge(v, v + 1);
+            if (r + 1 < rows)
+                out.edge(v, v + cols);
+        }
+    }
+}
+
+void GraphGenerator::hex(EdgeStreamWriter &out, int rows, int cols)
+{
+    // Coordenadas axiais: vizinhas (r, c±1), (r±1, c), (r-1, c+1), (r+1, c-1)
+    for (int r = 0; r < rows; ++r)
+    {
+        for (int c = 0; c < cols; ++c)
+        {
+            int v = r * cols + c;
+            if (c + 1 < cols)
+                out.edge(v, v + 1);
+            if (r + 1 < rows)
+            {
+                out.edge(v, v + cols);
+                if (c > 0)
+                    out.edge(v, v + cols - 1);
+            }
+        }
+    }
+}
+
+namespace
+{
+    void printGenerateUsage(const char *programName)
+    {
+        std::cout << "\nUso: " << programName << " generate <tipo> [opções] -o <arquivo>" << std::endl;
+        std::cout << "\nTipos:" << std::endl;
+        std::cout << "  gnp              G(n,p) de Erdős–Rényi (--n, --prob)" << std::endl;
+        std::cout << "  geometric        Disco unitário no quadrado unitário (--n, --radius)" << std::endl;
+        std::cout << "  dsjr             Estilo DSJR (--n, --radius, --complement)" << std::endl;
+        std::cout << "  grid             Grade 4-vizinhos (--rows, --cols)" << std::endl;
+        std::cout << "  hex              Grade hexagonal (--rows, --cols)" << std::endl;
+        std::cout << "\nOpções:" << std::endl;
+        std::cout << "  -o <arquivo>     Arquivo de saída [obrigatório]" << std::endl;
+        std::cout << "  --format <f>     dimacs|binary (padrão: dimacs)" << std::endl;
+        std::cout << "  -s <semente>     Semente (padrão: 1)" << std::endl;
+        std::cout << std::endl;
+    }
+}
+
+int GraphGenerator::runCommand(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        printGenerateUsage(argv[0]);
+        return 1;
+    }
+
+    std::string type = argv[2];
+    std::string outputFile;
+    std::string format = "dimacs";
+    int n = 0, rows = 0, cols = 0;
+    double prob = 0.0, radius = 0.0;
+    bool complement = false;
+    uint64_t seed = 1;
+
+    for (int i = 3; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc)
+            outputFile = argv[++i];
+        else if (arg == "--format" && i + 1 < argc)
+            format = argv[++i];
+        else if (arg == "-s" && i + 1 < argc)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--n" && i + 1 < argc)
+            n = std::atoi(argv[++i]);
+        else if (arg == "--prob" && i + 1 < argc)
+            prob = std::atof(argv[++i]);
+        else if (arg == "--radius" && i + 1 < argc)
+            radius = std::atof(argv[++i]);
+        else if (arg == "--rows" && i + 1 < argc)
+            rows = std::atoi(argv[++i]);
+        else if (arg == "--cols" && i + 1 < argc)
+            cols = std::atoi(argv[++i]);
+        else if (arg == "--complement")
+            complement = true;
+        else
+        {
+            std::cerr << "Erro: opção desconhecida no gerador: " << arg << std::endl;
+            printGenerateUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Tudo é validado antes de criar o arquivo de saída
+    if (type != "gnp" && type != "geometric" && type != "dsjr" && type != "grid" && type != "hex")
+    {
+        std::cerr << "Erro: tipo de gerador desconhecido: " << type << std::endl;
+        printGenerateUsage(argv[0]);
+        return 1;
+    }
+
+    if (outputFile.empty() || (format != "dimacs" && format != "binary"))
+    {
+        printGenerateUsage(argv[0]);
+        return 1;
+    }
+
+    bool gridLike = (type == "grid" || type == "hex");
+    if (gridLike)
+        n = rows * cols;
+    if (n <= 0)
+    {
+        std::cerr << "Erro: número de vértices inválido" << std::endl;
+        return 1;
+    }
+
+    EdgeStreamWriter out(outputFile, format == "binary" ? EdgeStreamWriter::Format::Binary
+                                                        : EdgeStreamWriter::Format::Dimacs);
+    if (!out.isOpen())
+    {
+        std::cerr << "Erro: não foi possível criar o arquivo " << outputFile << std::endl;
+        return 1;
+    }
+
+    std::string comment = "gerado por lpq_coloring: " + type + " n=" + std::to_string(n) +
+                          " seed=" + std::to_string(seed);
+    auto start = std::chrono::high_resolution_clock::now();
+    out.begin(n, comment);
+
+    if (type == "gnp")
+        gnp(out, n, prob, seed);
+    else if (type == "geometric")
+        geometric(out, n, radius, seed);
+    else if (type == "dsjr")
+        dsjr(out, n, radius, complement, seed);
+    else if (type == "grid")
+        grid(out, rows, cols);
+    else
+        hex(out, rows, cols);
+
+    if (!out.finish())
+    {
+        std::cerr << "Erro ao escrever " << outputFile << std::endl;
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    std::cout << "Grafo gerado: " << n << " vértices, " << out.getNumEdges() << " arestas em "
+              << elapsed.count() << " segundos -> " << outputFile << std::endl;
+    return 0;
+}
@@ -3,6 +3,9 @@
 #include <sstream>
 #include <iostream>
 #include <climits>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 //todo: verificação de edges para normalização se 0-based ou 1-based
 bool normalizeEdges(
@@ -253,8 +256,83 @@ bool InputReader::readGraphAdjList(const std::string &filename, Graph &graph)
     return true;
 }
 
+bool InputReader::readGraphBinary(const std::string &filename, Graph &graph)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo " << filename << std::endl;
+        return false;
+    }
+
+    unsigned char header[20];
+    if (!file.read(reinterpret_cast<char *>(header), sizeof(header)) || std::memcmp(header, "LPQB", 4) != 0)
+    {
+        std::cerr << "Erro: cabeçalho binário inválido" << std::endl;
+        return false;
+    }
+
+    auto readU32 = [](const unsigned char *b) {
+        return uint32_t(b[0]) | (uint32_t(b[1]) << 8) | (uint32_t(b[2]) << 16) | (uint32_t(b[3]) << 24);
+    };
+    uint32_t version = readU32(header + 4);
+    uint32_t numVertices = readU32(header + 8);
+    uint64_t numEdges = uint64_t(readU32(header + 12)) | (uint64_t(readU32(header + 16)) << 32);
+
+    if (version != 1 || numVertices == 0 || numVertices > INT_MAX)
+    {
+        std::cerr << "Erro: valores inválidos no cabeçalho" << std::endl;
+        return false;
+    }
+
+    graph = Graph(static_cast<int>(numVertices), false);
+
+    // Lê as arestas em blocos
+    std::vector<unsigned char> chunk(8 * 65536);
+    uint64_t remaining = numEdges;
+    while (remaining > 0)
+    {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(remaining, 65536));
+        if (!file.read(reinterpret_cast<char *>(chunk.data()), count * 8))
+        {
+            std::cerr << "Erro: arquivo binário truncado" << std::endl;
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            int u = static_cast<int>(readU32(&chunk[8 * i]));
+            int v = static_cast<int>(readU32(&chunk[8 * i + 4]));
+            try
+            {
+                graph.addEdge(u, v);
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Erro ao adicionar aresta (" << u << ", " << v << "): "
+                          << e.what() << std::endl;
+                return false;
+            }
+        }
+        remaining -= count;
+    }
+
+    std::cout << "Grafo binário carregado: " << numVertices << " vértices, "
+              << numEdges << " arestas" << std::endl;
+    return true;
+}
+
 bool InputReader::readGraphAuto(const std::string &filename, Graph &graph)
 {
+    // Formato binário: identificado pelo número mágico
+    {
+        std::ifstream probe(filename, std::ios::binary);
+        char magic[4] = {0, 0, 0, 0};
+        if (probe.read(magic, 4) && std::memcmp(magic, "LPQB", 4) == 0)
+        {
+            return readGraphBinary(filename, graph);
+        }
+    }
+
     // Detectar formato baseado na extensão
     if (filename.find(".dimacs") != std::string::npos ||
         filename.find(".col") != std::string::npos)
@@ -0,0 +1,352 @@
+#include "../include/JsonLine.h"
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+std::string JsonLine::Value::raw() const
+{
+    switch (type)
+    {
+    case Type::String:
+        return quote(text);
+    case Type::Number:
+        return text;
+    case Type::Bool:
+        return boolean ? "true" : "false";
+    default:
+        return "null";
+    }
+}
+
+std::string JsonLine::quote(const std::string &text)
+{
+    std::string out = "\"";
+    for (unsigned char c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\r':
+            out += "\\r";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (c < 0x20)
+            {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            }
+            else
+            {
+                out += static_cast<char>(c);
+            }
+        }
+    }
+    out += '"';
+    return out;
+}
+
+namespace
+{
+    // Cursor sobre a linha com as regras léxicas usadas pelo objeto plano
+    struct Cursor
+    {
+        const std::string &s;
+        size_t pos;
+
+        void skipSpace()
+        {
+            while (pos < s.size() && std::isspace(static_cast<unsigned char>(s[pos])))
+                ++pos;
+        }
+        bool consume(char c)
+        {
+            skipSpace();
+            if (pos < s.size() && s[pos] == c)
+            {
+                ++pos;
+                return true;
+            }
+            return false;
+        }
+        bool literal(const char *word)
+        {
+            size_t len = std::char_traits<char>::length(word);
+            if (s.compare(pos, len, word) == 0)
+            {
+                pos += len;
+                return true;
+            }
+            return false;
+        }
+
+        bool readString(std::string &out)
+        {
+            if (!consume('"'))
+                return false;
+            out.clear();
+            while (pos < s.size())
+            {
+                char c = s[pos++];
+                if (c == '"')
+                    return true;
+                if (c != '\\')
+                {
+                    out += c;
+                    continue;
+                }
+                if (pos >= s.size())
+                    return false;
+                char e = s[pos++];
+                switch (e)
+                {
+                case 'n':
+                    out += '\n';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'r':
+                    out += '\r';
+                    break;
+                case 'b':
+                    out += '\b';
+                    break;
+                case 'f':
+                    out += '\f';
+                    break;
+                case 'u':
+                {
+                    unsigned long code;
+                    if (!readHex4(code))
+                        return false;
+                    // Par substituto: \uD8xx\uDCxx forma um ponto acima do BMP
+                    if (code >= 0xD800 && code <= 0xDBFF && s.compare(pos, 2, "\\u") == 0)
+                    {
+                        size_t save = pos;
+                        pos += 2;
+                        unsigned long low;
+                        if (readHex4(low) && low >= 0xDC00 && low <= 0xDFFF)
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        else
+                            pos = save;
+                    }
+                    // Substituto isolado: caractere de substituição U+FFFD
+                    if (code >= 0xD800 && code <= 0xDFFF)
+                        code = 0xFFFD;
+                    appendUtf8(out, code);
+                    break;
+                }
+                default:
+                    out += e; // \" \\ \/
+                }
+            }
+            return false;
+        }
+
+        bool readHex4(unsigned long &code)
+        {
+            if (pos + 4 > s.size())
+                return false;
+            code = 0;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                char c = s[pos + i];
+                if (!std::isxdigit(static_cast<unsigned char>(c)))
+                    return false;
+                code = code * 16 + (std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : (std::tolower(c) - 'a' + 10));
+            }
+            pos += 4;
+            return true;
+        }
+
+        static void appendUtf8(std::string &out, unsigned long code)
+        {
+            if (code < 0x80)
+            {
+                out += static_cast<char>(code);
+            }
+            else if (code < 0x800)
+            {
+                out += static_cast<char>(0xC0 | (code >> 6));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            }
+            else if (code < 0x10000)
+            {
+                out += static_cast<char>(0xE0 | (code >> 12));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                out += static_cast<char>(0xF0 | (code >> 18));
+                out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (code & 0x3F));
+            }
+        }
+
+        bool readNumber(std::string &out)
+        {
+            size_t start = pos;
+            if (pos < s.size() && (s[pos] == '-' || s[pos] == '+'))
+                ++pos;
+            while (pos < s.size() && (std::isdigit(static_cast<unsigned char>(s[pos])) || s[pos] == '.' ||
+                                      s[pos] == 'e' || s[pos] == 'E' || s[pos] == '-' || s[pos] == '+'))
+                ++pos;
+            out = s.substr(start, pos - start);
+            return pos > start;
+        }
+    };
+}
+
+bool JsonLine::parseObject(const std::string &line, std::map<std::string, Value> &fields, std::string &error)
+{
+    fields.clear();
+    Cursor cur{line, 0};
+    if (!cur.consume('{'))
+    {
+        error = "esperado '{'";
+        return false;
+    }
+    if (cur.consume('}'))
+        return true;
+
+    while (true)
+    {
+        std::string name;
+        cur.skipSpace();
+        if (!cur.readString(name))
+        {
+            error = "chave inválida";
+            return false;
+        }
+        if (!cur.consume(':'))
+        {
+            error = "esperado ':' após \"" + name + "\"";
+            return false;
+        }
+
+        Value value;
+        cur.skipSpace();
+        if (cur.pos < line.size() && line[cur.pos] == '"')
+        {
+            value.type = Value::Type::String;
+            if (!cur.readString(value.text))
+            {
+                error = "texto inválido em \"" + name + "\"";
+                return false;
+            }
+        }
+        else if (cur.literal("true"))
+        {
+            value.type = Value::Type::Bool;
+            value.boolean = true;
+        }
+        else if (cur.literal("false"))
+        {
+            value.type = Value::Type::Bool;
+        }
+        else if (cur.literal("null"))
+        {
+            value.type = Value::Type::Null;
+        }
+        else if (cur.readNumber(value.text))
+        {
+            value.type = Value::Type::Number;
+        }
+        else
+        {
+            error = "valor não suportado em \"" + name + "\" (apenas escalares)";
+            return false;
+        }
+        fields[name] = value;
+
+        if (cur.consume(','))
+            continue;
+        if (cur.consume('}'))
+            break;
+        error = "esperado ',' ou '}'";
+        return false;
+    }
+
+    cur.skipSpace();
+    if (cur.pos != line.size())
+    {
+        error = "texto após o objeto";
+        return false;
+    }
+    return true;
+}
+
+void JsonBuilder::key(const std::string &name)
+{
+    if (!body.empty())
+        body += ',';
+    body += JsonLine::quote(name);
+    body += ':';
+}
+
+JsonBuilder &JsonBuilder::add(const std::string &name, const std::string &value)
+{
+    key(name);
+    body += JsonLine::quote(value);
+    return *this;
+}
+
+JsonBuilder &JsonBuilder::add(const std::string &name, long long value)
+{
+    key(name);
+    body += std::to_string(value);
+    return *this;
+}
+
+JsonBuilder &JsonBuilder::add(const std::string &name, double value)
+{
+    std::ostringstream out;
+    out.precision(6);
+    out << value;
+    key(name);
+    body += out.str();
+    return *this;
+}
+
+JsonBuilder &JsonBuilder::add(const std::string &name, bool value)
+{
+    key(name);
+    body += value ? "true" : "false";
+    return *this;
+}
+
+JsonBuilder &JsonBuilder::add(const std::string &name, const std::vector<int> &values)
+{
+    key(name);
+    body += '[';
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        if (i > 0)
+            body += ',';
+        body += std::to_string(values[i]);
+    }
+    body += ']';
+    return *this;
+}
+
+JsonBuilder &JsonBuilder::addRaw(const std::string &name, const std::string &json)
+{
+    key(name);
+    body += json;
+    return *this;
+}
@@ -0,0 +1,217 @@
+#include "../include/LowerBound.h"
+#include "../include/VertexOrdering.h"
+#include <algorithm>
+
+namespace
+{
+    // Número de vizinhos distintos (ignora laços e arestas repetidas)
+    int distinctDegree(const Graph &graph, int v, std::vector<int> &mark, int stamp)
+    {
+        int d = 0;
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u == v || mark[u] == stamp)
+                continue;
+            mark[u] = stamp;
+            ++d;
+        }
+        return d;
+    }
+}
+
+int LowerBound::degreeBound(const Graph &graph, int p, int q)
+{
+    int n = graph.getNumVertices();
+    if (n == 0)
+        return 0;
+
+    std::vector<int> mark(n, -1);
+    int maxDegree = 0;
+    for (int v = 0; v < n; ++v)
+    {
+        maxDegree = std::max(maxDegree, distinctDegree(graph, v, mark, v));
+    }
+
+    if (maxDegree == 0)
+        return 1;
+
+    int span = (p >= q) ? p + (maxDegree - 1) * q : std::max(maxDegree * p, (maxDegree - 1) * q);
+    return span + 1;
+}
+
+int LowerBound::cliqueBound(const Graph &graph, int p, int q, int *cliqueSize)
+{
+    (void)q;
+    int n = graph.getNumVertices();
+    if (n == 0)
+    {
+        if (cliqueSize)
+            *cliqueSize = 0;
+        return 0;
+    }
+
+    std::vector<int> order = VertexOrdering::byDegree(graph);
+    std::vector<int> mark(n, -1);
+    int stamp = 0;
+    int best = 1;
+
+    int seeds = std::min(CLIQUE_SEEDS, n);
+    for (int s = 0; s < seeds; ++s)
+    {
+        int v = order[s];
+        if (graph.getDegree(v) + 1 <= best)
+            break;
+
+        // Candidatos: vizinhos de v; a cada passo escolhe o de maior grau e
+        // restringe os candidatos à sua vizinhança
+        std::vector<int> candidates;
+        ++stamp;
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u != v && mark[u] != stamp)
+            {
+                mark[u] = stamp;
+                candidates.push_back(u);
+            }
+        }
+
+        int size = 1;
+        while (!candidates.empty())
+        {
+            auto it = std::max_element(candidates.begin(), candidates.end(), [&graph](int a, int b) {
+                return graph.getDegree(a) < graph.getDegree(b);
+            });
+            int chosen = *it;
+            ++size;
+
+            ++stamp;
+            for (int u : graph.getNeighbors(chosen))
+                mark[u] = stamp;
+
+            std::vector<int> next;
+            for (int u : candidates)
+            {
+                if (u != chosen && mark[u] == stamp)
+                    next.push_back(u);
+            }
+            candidates.swap(next);
+        }
+
+        best = std::max(best, size);
+    }
+
+    if (cliqueSize)
+        *cliqueSize = best;
+    return (best - 1) * p + 1;
+}
+
+std::vector<int> LowerBound::findSquareClique(const Graph &graph)
+{
+    int n = graph.getNumVertices();
+    std::vector<int> bestClique;
+    if (n == 0)
+        return bestClique;
+
+    std::vector<int> order = VertexOrdering::byDegree(graph);
+    std::vector<int> mark(n, -1);
+    int stamp = 0;
+    long long work = 0;
+
+    int seeds = std::min(CLIQUE_SEEDS, n);
+    for (int s = 0; s < seeds && work < SQUARE_WORK_BUDGET; ++s)
+    {
+        int v = order[s];
+
+        // A vizinhança fechada de v é uma clique de G²
+        std::vector<int> clique;
+        ++stamp;
+        mark[v] = stamp;
+        clique.push_back(v);
+        for (int u : graph.getNeighbors(v))
+        {
+            if (mark[u] != stamp)
+            {
+                mark[u] = stamp;
+                clique.push_back(u);
+            }
+        }
+
+        // Candidatos: vértices a distância exatamente 2 de v
+        int closedStamp = stamp;
+        std::vector<int> candidates;
+        ++stamp;
+        for (int u : graph.getNeighbors(v))
+        {
+            for (int w : graph.getNeighbors(u))
+            {
+                if (mark[w] != closedStamp && mark[w] != stamp)
+                {
+                    mark[w] = stamp;
+                    candidates.push_back(w);
+                }
+            }
+            work += graph.getDegree(u);
+        }
+        VertexOrdering::sortByDegree(graph, candidates);
+
+        for (int w : candidates)
+        {
+            if (work >= SQUARE_WORK_BUDGET)
+                break;
+
+            // Marcar N1[w] ∪ N2(w)
+            ++stamp;
+            mark[w] = stamp;
+            for (int u : graph.getNeighbors(w))
+            {
+                mark[u] = stamp;
+                for (int x : graph.getNeighbors(u))
+                    mark[x] = stamp;
+                work += graph.getDegree(u);
+            }
+
+            bool fits = true;
+            for (int u : clique)
+            {
+                if (mark[u] != stamp)
+                {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits)
+                clique.push_back(w);
+        }
+
+        if (clique.size() > bestClique.size())
+            bestClique = clique;
+    }
+
+    return bestClique;
+}
+
+int LowerBound::squareCliqueBound(const Graph &graph, int p, int q, int *cliqueSize)
+{
+    std::vector<int> clique = findSquareClique(graph);
+    int k = static_cast<int>(clique.size());
+    if (cliqueSize)
+        *cliqueSize = k;
+    if (k == 0)
+        return 0;
+    return (k - 1) * std::min(p, q) + 1;
+}
+
+int LowerBound::compute(const Graph &graph, int p, int q)
+{
+    int bound = degreeBound(graph, p, q);
+    bound = std::max(bound, cliqueBound(graph, p, q));
+    bound = std::max(bound, squareCliqueBound(graph, p, q));
+    return bound;
+}
+
+double LowerBound::gap(int maxColor, int bound)
+{
+    if (bound <= 0)
+        return -1.0;
+    return static_cast<double>(maxColor - bound) / static_cast<double>(bound);
+}
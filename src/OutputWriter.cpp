@@ -1,9 +1,13 @@
 #include "../include/OutputWriter.h"
+#include "../include/ColorKernel.h"
+#include "../include/CompressedDistance2.h"
+#include "../include/Distance2Cache.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <set>
 
 void OutputWriter::printSolution(const std::vector<int> &coloring, int maxColor)
@@ -119,10 +123,26 @@ bool OutputWriter::validateColoring(const Graph &graph,
 
     bool valid = true;
 
+    // As cores dos vizinhos são reunidas em um buffer contíguo e testadas
+    // pelo kernel vetorial; só os vértices com violação são reexaminados um a
+    // um para a mensagem. O deslocamento +1 mantém a cor 0 (válida aqui)
+    // distinta do marcador "não colorido" do kernel.
+    std::vector<int> gathered;
+
     // Verificar restrição para vértices adjacentes (distância 1)
     for (int u = 0; u < n; u++)
     {
         const auto &neighbors = graph.getNeighbors(u);
+        gathered.resize(neighbors.size());
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            gathered[i] = coloring[neighbors[i]] + 1;
+        }
+        if (ColorKernel::violationJump(gathered.data(), gathered.size(), coloring[u] + 1, p) == 0)
+        {
+            continue;
+        }
+
         for (int v : neighbors)
         {
             int colorDiff = std::abs(coloring[u] - coloring[v]);
@@ -136,9 +156,48 @@ bool OutputWriter::validateColoring(const Graph &graph,
     }
 
     // Verificar restrição para vértices a distância 2
+    // Sem índice, cada N2(u) é lido uma única vez: do índice comprimido, se
+    // houver, ou por varredura com marcas, sem cache
+    const CompressedDistance2 *compressed = graph.getCompressedDistance2();
+    std::unique_ptr<Distance2Cache> distance2Scan;
+    if (!graph.hasDistance2Index() && !compressed)
+        distance2Scan.reset(new Distance2Cache(graph, 0));
     for (int u = 0; u < n; u++)
     {
-        auto distance2Vertices = graph.getVerticesAtDistance2(u);
+        if (compressed)
+        {
+            gathered.resize(compressed->count(u));
+            compressed->gather(u, coloring.data(), gathered.data());
+            for (int &c : gathered)
+                ++c;
+            if (ColorKernel::violationJump(gathered.data(), gathered.size(), coloring[u] + 1, q) == 0)
+                continue;
+
+            compressed->forEach(u, [&](int v)
+                                {
+                int colorDiff = std::abs(coloring[u] - coloring[v]);
+                if (colorDiff < q)
+                {
+                    std::cerr << "Violação (distância 2): vértices " << u << " e " << v
+                              << " têm diferença de cor " << colorDiff << " < " << q << std::endl;
+                    valid = false;
+                } });
+            continue;
+        }
+
+        const std::vector<int> &distance2Vertices =
+            distance2Scan ? distance2Scan->get(u) : graph.getDistance2Neighbors(u);
+
+        gathered.resize(distance2Vertices.size());
+        for (size_t i = 0; i < distance2Vertices.size(); i++)
+        {
+            gathered[i] = coloring[distance2Vertices[i]] + 1;
+        }
+        if (ColorKernel::violationJump(gathered.data(), gathered.size(), coloring[u] + 1, q) == 0)
+        {
+            continue;
+        }
+
         for (int v : distance2Vertices)
         {
             int colorDiff = std::abs(coloring[u] - coloring[v]);
@@ -0,0 +1,134 @@
+#include "../include/PathRelinking.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+PathRelinking::PathRelinking(const Graph &g, int p, int q)
+    : graph(g), p_param(p), q_param(q), lastMaxColor(INT_MAX)
+{
+}
+
+// Número de vizinhos (N1 e N2) de v que conflitam com a cor c
+int PathRelinking::conflictsOf(int v, int c) const
+{
+    int count = 0;
+    for (int u : graph.getNeighbors(v))
+    {
+        if (u != v && std::abs(c - current[u]) < p_param)
+            ++count;
+    }
+    for (int u : graph.getDistance2Neighbors(v))
+    {
+        if (std::abs(c - current[u]) < q_param)
+            ++count;
+    }
+    return count;
+}
+
+// Atualiza os contadores dos vértices ainda diferentes da guia quando u
+// troca oldColor por newColor
+void PathRelinking::shiftColor(int u, int oldColor, int newColor, const std::vector<int> &guide)
+{
+    for (int w : graph.getNeighbors(u))
+    {
+        if (w == u || diffPos[w] < 0)
+            continue;
+        conflictsCur[w] += (std::abs(current[w] - newColor) < p_param) - (std::abs(current[w] - oldColor) < p_param);
+        conflictsGuide[w] += (std::abs(guide[w] - newColor) < p_param) - (std::abs(guide[w] - oldColor) < p_param);
+    }
+    for (int w : graph.getDistance2Neighbors(u))
+    {
+        if (diffPos[w] < 0)
+            continue;
+        conflictsCur[w] += (std::abs(current[w] - newColor) < q_param) - (std::abs(current[w] - oldColor) < q_param);
+        conflictsGuide[w] += (std::abs(guide[w] - newColor) < q_param) - (std::abs(guide[w] - oldColor) < q_param);
+    }
+}
+
+const std::vector<int> &PathRelinking::relink(const std::vector<int> &start, const std::vector<int> &guide)
+{
+    int n = graph.getNumVertices();
+    current.assign(start.begin(), start.end());
+
+    int maxColor = 0;
+    for (int v = 0; v < n; ++v)
+    {
+        maxColor = std::max(maxColor, std::max(current[v], guide[v]));
+    }
+    colorCount.assign(maxColor + 1, 0);
+    maxColor = 0;
+    for (int v = 0; v < n; ++v)
+    {
+        ++colorCount[current[v]];
+        maxColor = std::max(maxColor, current[v]);
+    }
+
+    diffList.clear();
+    diffPos.assign(n, -1);
+    conflictsCur.assign(n, 0);
+    conflictsGuide.assign(n, 0);
+    for (int v = 0; v < n; ++v)
+    {
+        if (current[v] != guide[v])
+        {
+            diffPos[v] = static_cast<int>(diffList.size());
+            diffList.push_back(v);
+            conflictsCur[v] = conflictsOf(v, current[v]);
+            conflictsGuide[v] = conflictsOf(v, guide[v]);
+        }
+    }
+
+    // start é viável (saída de uma construção), logo começa sem conflitos
+    long long conflicts = 0;
+    best.assign(start.begin(), start.end());
+    int bestMaxColor = maxColor;
+
+    // O último passo levaria à própria guia, que já está no conjunto elite
+    while (diffList.size() > 1)
+    {
+        // Escolhe o movimento com menor variação de conflitos (e menor cor)
+        int chosenIdx = 0;
+        int chosenDelta = INT_MAX;
+        for (int i = 0; i < static_cast<int>(diffList.size()); ++i)
+        {
+            int v = diffList[i];
+            int delta = conflictsGuide[v] - conflictsCur[v];
+            if (delta < chosenDelta || (delta == chosenDelta && guide[v] < guide[diffList[chosenIdx]]))
+            {
+                chosenDelta = delta;
+                chosenIdx = i;
+            }
+        }
+
+        int v = diffList[chosenIdx];
+        int oldColor = current[v];
+        int newColor = guide[v];
+
+        // Remove v da lista de diferenças
+        int last = diffList.back();
+        diffList[chosenIdx] = last;
+        diffPos[last] = chosenIdx;
+        diffList.pop_back();
+        diffPos[v] = -1;
+
+        conflicts += chosenDelta;
+        current[v] = newColor;
+        shiftColor(v, oldColor, newColor, guide);
+
+        // Contabilidade da maior cor
+        --colorCount[oldColor];
+        ++colorCount[newColor];
+        maxColor = std::max(maxColor, newColor);
+        while (maxColor > 0 && colorCount[maxColor] == 0)
+            --maxColor;
+
+        if (conflicts == 0 && maxColor < bestMaxColor)
+        {
+            bestMaxColor = maxColor;
+            best.assign(current.begin(), current.end());
+        }
+    }
+
+    lastMaxColor = bestMaxColor;
+    return best;
+}
@@ -0,0 +1,160 @@
+#include "../include/Portfolio.h"
+#include "../include/Config.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+bool Portfolio::parse(const std::string &spec, const SolverOptions &base,
+                      int iterations, int blockSize, std::vector<Entry> &entries)
+{
+    entries.clear();
+    std::stringstream ss(spec);
+    std::string token;
+    while (std::getline(ss, token, ','))
+    {
+        if (token.empty())
+            continue;
+
+        Entry entry;
+        entry.label = token;
+        entry.options = base;
+        SolverOptions &opt = entry.options;
+
+        size_t colon = token.find(':');
+        opt.algorithm = token.substr(0, colon);
+        if (colon != std::string::npos)
+        {
+            if (opt.algorithm != Config::ALGORITHM_GRASP)
+            {
+                std::cerr << "Erro: alpha só se aplica a grasp no portfólio: " << token << std::endl;
+                return false;
+            }
+            opt.alpha = std::atof(token.c_str() + colon + 1);
+            if (opt.alpha < Config::MIN_ALPHA || opt.alpha > Config::MAX_ALPHA)
+            {
+                std::cerr << "Erro: alpha fora de [0, 1] no portfólio: " << token << std::endl;
+                return false;
+            }
+        }
+
+        if (opt.algorithm == Config::ALGORITHM_GREEDY || opt.algorithm == Config::ALGORITHM_GRASP)
+        {
+            opt.iterations = iterations > 0 ? iterations : Config::DEFAULT_ITERATIONS;
+        }
+        else if (opt.algorithm == Config::ALGORITHM_REACTIVE)
+        {
+            opt.iterations = iterations > 0 ? iterations : Config::DEFAULT_REACTIVE_ITERATIONS;
+            opt.blockSize = blockSize > 0 ? blockSize : Config::DEFAULT_BLOCK_SIZE_GRASPR;
+        }
+        else if (opt.algorithm == Config::ALGORITHM_TABU)
+        {
+            opt.iterations = iterations > 0 ? iterations : Config::DEFAULT_TABU_ITERATIONS;
+        }
+        else if (opt.algorithm == Config::ALGORITHM_DSATUR)
+        {
+            // Construção única, sem parâmetros
+        }
+        else
+        {
+            std::cerr << "Erro: algoritmo desconhecido no portfólio: " << token << std::endl;
+            return false;
+        }
+
+        // Cada configuração ocupa uma thread; o paralelismo vem da corrida
+        opt.numThreads = 1;
+        opt.verbose = false;
+        opt.checkpointFile.clear();
+        entries.push_back(entry);
+    }
+
+    if (entries.empty())
+    {
+        std::cerr << "Erro: portfólio vazio" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::vector<Portfolio::Entry> Portfolio::defaults(const SolverOptions &base, int iterations, int blockSize)
+{
+    std::vector<Entry> entries;
+    parse(Config::DEFAULT_PORTFOLIO, base, iterations, blockSize, entries);
+    return entries;
+}
+
+Portfolio::Portfolio(const Graph &g, std::vector<Entry> list)
+    : graph(g), entries(std::move(list)), winner(-1), timedOut(false), baseSeed(0)
+{
+}
+
+SolverResult Portfolio::run(int numWorkers, int target, double timeLimitSeconds)
+{
+    SharedIncumbent incumbent(target, timeLimitSeconds);
+
+    // Sementes derivadas de uma única base, uma por configuração
+    const unsigned int base = baseSeed != 0 ? baseSeed : static_cast<unsigned int>(std::rand());
+
+    std::vector<SolverResult> results(entries.size());
+    stats.assign(entries.size(), {false, 0, 0.0});
+    std::atomic<size_t> nextEntry(0);
+
+    auto worker = [&]()
+    {
+        size_t k;
+        while ((k = nextEntry.fetch_add(1)) < entries.size())
+        {
+            // Configurações ainda na fila quando a corrida acaba não rodam
+            if (incumbent.shouldStop())
+                continue;
+
+            stats[k].started = true;
+            auto start = std::chrono::high_resolution_clock::now();
+            SolverOptions opt = entries[k].options;
+            opt.incumbent = &incumbent;
+            opt.randomSeed = base + 0x9E3779B9u * static_cast<unsigned int>(k + 1);
+            if (opt.randomSeed == 0)
+                opt.randomSeed = 1;
+
+            results[k] = Solver::run(graph, opt);
+
+            std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+            const std::vector<int> &coloring = results[k].coloring;
+            stats[k].maxColor = coloring.empty() ? 0 : *std::max_element(coloring.begin(), coloring.end());
+            stats[k].seconds = elapsed.count();
+        }
+    };
+
+    int threads = std::max(1, std::min(numWorkers, static_cast<int>(entries.size())));
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (auto &th : pool)
+        th.join();
+
+    timedOut = incumbent.timedOut();
+
+    winner = -1;
+    int bestMaxColor = INT_MAX;
+    for (size_t k = 0; k < entries.size(); ++k)
+    {
+        if (stats[k].maxColor > 0 && stats[k].maxColor < bestMaxColor)
+        {
+            bestMaxColor = stats[k].maxColor;
+            winner = static_cast<int>(k);
+        }
+    }
+
+    if (winner < 0)
+    {
+        SolverResult none;
+        none.ok = false;
+        return none;
+    }
+    return results[winner];
+}
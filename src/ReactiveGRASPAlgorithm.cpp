@@ -1,9 +1,18 @@
 #include "../include/ReactiveGRASPAlgorithm.h"
 #include "../include/Config.h"
+#include "../include/ElitePool.h"
+#include "../include/OutputWriter.h"
+#include "../include/PathRelinking.h"
+#include "../include/WorkStealingScheduler.h"
 #include <algorithm>
 #include <climits>
 #include <cstdlib>
 #include <numeric>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <iostream>
+#include <memory>
 
 ReactiveGRASPAlgorithm::ReactiveGRASPAlgorithm(const Graph &g,
                                                int p,
@@ -22,105 +31,27 @@ ReactiveGRASPAlgorithm::ReactiveGRASPAlgorithm(const Graph &g,
       alphaUsageCount(alphaValues.size(), 0),
       bestAlphaUsed(alphaValues.front()),
       bestMaxColor(INT_MAX),
-      averageSolution(0.0)
+      averageSolution(0.0),
+      iterationsExecuted(0),
+      lowerBound(0),
+      numThreads(1),
+      eliteSize(0),
+      relinkImprovements(0),
+      rclSampleSize(0),
+      rclSampleFraction(0.0),
+      hasLocalSeed(false),
+      localSeed(0),
+      incumbent(nullptr),
+      checkpointInterval(Config::DEFAULT_CHECKPOINT_INTERVAL),
+      checkpointSeed(0),
+      checkpointsWritten(0),
+      resumePending(false),
+      engine(g, p, q)
 {
     double initialProb = 1.0 / static_cast<double>(alphaValues.size());
     std::fill(alphaProbabilities.begin(), alphaProbabilities.end(), initialProb);
 }
 
-int ReactiveGRASPAlgorithm::findSmallestValidColor(int v, const std::vector<int> &coloring)
-{
-    int color = 1;
-    while (true)
-    {
-        bool ok = true;
-
-        const auto &nbrs = graph.getNeighbors(v);
-        for (int u : nbrs)
-        {
-            if (coloring[u] == 0)
-                continue;
-            if (std::abs(color - coloring[u]) < p_param)
-            {
-                ok = false;
-                break;
-            }
-        }
-
-        if (!ok)
-        {
-            ++color;
-            continue;
-        }
-
-        auto dist2 = graph.getVerticesAtDistance2(v);
-        for (int u : dist2)
-        {
-            if (coloring[u] == 0)
-                continue;
-            if (std::abs(color - coloring[u]) < q_param)
-            {
-                ok = false;
-                break;
-            }
-        }
-
-        if (ok)
-            break;
-        ++color;
-    }
-    return color;
-}
-
-std::vector<int> ReactiveGRASPAlgorithm::constructGreedyRandomized(double alpha)
-{
-    int n = graph.getNumVertices();
-    std::vector<int> coloring(n, 0);
-    std::vector<bool> colored(n, false);
-
-    for (int count = 0; count < n; ++count)
-    {
-        std::vector<std::pair<int, int>> candidates;
-
-        for (int v = 0; v < n; ++v)
-        {
-            if (colored[v])
-                continue;
-            int minColor = findSmallestValidColor(v, coloring);
-            candidates.emplace_back(minColor, v);
-        }
-
-        if (candidates.empty())
-            break;
-
-        int cMin = INT_MAX, cMax = INT_MIN;
-        for (const auto &c : candidates)
-        {
-            cMin = std::min(cMin, c.first);
-            cMax = std::max(cMax, c.first);
-        }
-
-        double threshold = cMin + alpha * (cMax - cMin);
-        std::vector<std::pair<int, int>> rcl;
-        for (const auto &c : candidates)
-        {
-            if (c.first <= threshold)
-            {
-                rcl.push_back(c);
-            }
-        }
-
-        int idx = std::rand() % rcl.size();
-        int chosenVertex = rcl[idx].second;
-        int chosenColor = rcl[idx].first;
-
-        coloring[chosenVertex] = chosenColor;
-        colored[chosenVertex] = true;
-    }
-
-    return coloring;
-}
-
 void ReactiveGRASPAlgorithm::updateAlphaProbabilities()
 {
     std::vector<double> rewards(alphaValues.size(), 0.0);
@@ -146,9 +77,8 @@ void ReactiveGRASPAlgorithm::updateAlphaProbabilities()
     }
 }
 
-int ReactiveGRASPAlgorithm::selectAlphaIndex()
+int ReactiveGRASPAlgorithm::selectAlphaIndex(double r) const
 {
-    double r = static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX);
     double cumulative = 0.0;
     for (size_t i = 0; i < alphaProbabilities.size(); ++i)
     {
@@ -161,20 +91,89 @@ int ReactiveGRASPAlgorithm::selectAlphaIndex()
 
 std::vector<int> ReactiveGRASPAlgorithm::solve()
 {
+    if (numThreads > 1)
+        return solveParallel();
+
     std::vector<int> bestColoring;
     double sumSolutions = 0.0;
+    iterationsExecuted = 0;
+    relinkImprovements = 0;
+
+    ElitePool pool(eliteSize, static_cast<int>(Config::ELITE_MIN_DISTANCE_FRACTION * graph.getNumVertices()));
+    PathRelinking relinker(graph, p_param, q_param);
+
+    // Buffer reutilizado entre iterações (sem alocação em regime permanente)
+    std::vector<int> coloring;
+    coloring.reserve(graph.getNumVertices());
+    bestColoring.reserve(graph.getNumVertices());
+
+    if (!initialSolution.empty())
+        applyInitialSolution(bestColoring, pool);
+
+    // Com checkpoint, o motor usa um gerador próprio semeado pela semente do
+    // checkpoint: sorteios de std::rand feitos fora dele (ex.: pela ordem
+    // aleatória do guloso inicial) não entram na contagem de sorteios
+    if (!hasLocalSeed && (!checkpointFile.empty() || resumePending))
+        engine.rng().seedLocal(resumePending ? resumeState.seed : checkpointSeed);
+
+    int startIteration = 0;
+    if (resumePending)
+    {
+        int unusedBestIteration = 0;
+        restoreState(bestColoring, sumSolutions, unusedBestIteration, pool);
+        engine.rng().skip(resumeState.rngDraws);
+        startIteration = resumeState.nextIteration;
+    }
+
+    std::unique_ptr<CheckpointWriter> writer;
+    if (!checkpointFile.empty())
+        writer.reset(new CheckpointWriter(checkpointFile));
+    auto lastCheckpoint = std::chrono::steady_clock::now();
 
-    for (int iter = 0; iter < totalIterations; ++iter)
+    for (int iter = startIteration; iter < totalIterations; ++iter)
     {
         if (iter > 0 && iter % blockSize == 0)
         {
+            std::chrono::duration<double> sinceCheckpoint = std::chrono::steady_clock::now() - lastCheckpoint;
+            if (writer && sinceCheckpoint.count() >= checkpointInterval)
+            {
+                ReactiveCheckpoint state = snapshot(iter, bestColoring, sumSolutions, 0, pool);
+                state.seed = checkpointSeed;
+                state.rngDraws = engine.rng().draws;
+                writer->submit(state.serialize());
+                lastCheckpoint = std::chrono::steady_clock::now();
+            }
             updateAlphaProbabilities();
         }
+        if (incumbent && incumbent->shouldStop())
+            break;
+        ++iterationsExecuted;
 
-        int alphaIndex = selectAlphaIndex();
+        int alphaIndex = selectAlphaIndex(engine.rng().nextUnit());
         double alpha = alphaValues[alphaIndex];
 
-        std::vector<int> coloring = constructGreedyRandomized(alpha);
+        engine.selection().setAlpha(alpha);
+
+        // Com incumbente compartilhado (e sem religamento), a construção é
+        // abandonada ao atingir a melhor maior cor conhecida e pontuada como
+        // se terminasse nela
+        if (incumbent && eliteSize == 0)
+        {
+            int cutoff = std::min(bestMaxColor, incumbent->getBestSpan());
+            if (!engine.constructBelow(cutoff))
+            {
+                sumSolutions += cutoff;
+                alphaRewardSum[alphaIndex] += 1.0 / static_cast<double>(std::max(1, cutoff));
+                alphaUsageCount[alphaIndex] += 1;
+                continue;
+            }
+        }
+        else
+        {
+            engine.construct();
+        }
+        const std::vector<int> &constructed = engine.current();
+        coloring.assign(constructed.begin(), constructed.end());
 
         int maxColor = 0;
         for (int c : coloring)
@@ -182,6 +181,18 @@ std::vector<int> ReactiveGRASPAlgorithm::solve()
             maxColor = std::max(maxColor, c);
         }
 
+        // Religamento com um membro do conjunto elite
+        if (eliteSize > 0)
+        {
+            int relinkedMax = relinker.relinkWithPool(coloring, maxColor, pool, engine.rng());
+            if (relinkedMax < maxColor)
+            {
+                maxColor = relinkedMax;
+                ++relinkImprovements;
+            }
+            pool.tryInsert(coloring, maxColor);
+        }
+
         sumSolutions += maxColor;
 
         alphaRewardSum[alphaIndex] += 1.0 / static_cast<double>(std::max(1, maxColor));
@@ -192,10 +203,347 @@ std::vector<int> ReactiveGRASPAlgorithm::solve()
             bestMaxColor = maxColor;
             bestColoring = coloring;
             bestAlphaUsed = alpha;
+            if (incumbent)
+                incumbent->publish(bestMaxColor);
         }
+
+        // Limite inferior atingido: nenhuma iteração pode melhorar a solução
+        if (lowerBound > 0 && bestMaxColor <= lowerBound)
+            break;
+    }
+
+    if (writer)
+    {
+        writer->flush();
+        checkpointsWritten = writer->getWritesCompleted();
     }
 
-    averageSolution = sumSolutions / static_cast<double>(totalIterations);
+    averageSolution = sumSolutions / static_cast<double>(std::max(1, iterationsExecuted));
 
     return bestColoring;
 }
+
+// Versão paralela síncrona por bloco: as iterações de um bloco são
+// independentes (as probabilidades só mudam entre blocos), então são
+// enviadas como tarefas a um escalonador com roubo de trabalho; cada worker
+// usa seu próprio motor. Os resultados ficam em uma posição por iteração e
+// são reduzidos em ordem de iteração antes de updateAlphaProbabilities. Cada
+// iteração usa um gerador semeado por (semente base, índice da iteração), de
+// modo que o resultado não depende do número de threads nem do escalonamento.
+// Ao atingir o limite inferior, só as iterações posteriores à primeira que o
+// atingiu são descartadas (exceto com incumbente compartilhado, cuja parada
+// vem de fora).
+std::vector<int> ReactiveGRASPAlgorithm::solveParallel()
+{
+    using ParallelEngine = ConstructionEngine<RCLSelection, MersenneRng, LowestIdTieBreak>;
+
+    struct IterationResult
+    {
+        bool executed = false;
+        bool relinked = false;
+        int alphaIndex = 0;
+        int maxColor = 0;
+    };
+
+    struct WorkerBest
+    {
+        int maxColor = INT_MAX;
+        int iteration = INT_MAX;
+        double alpha = 0.0;
+        std::vector<int> coloring;
+    };
+
+    unsigned int baseSeed = localSeed;
+    if (resumePending)
+        baseSeed = resumeState.baseSeed;
+    else if (!hasLocalSeed)
+        baseSeed = static_cast<unsigned int>(std::rand());
+
+    WorkStealingScheduler scheduler(numThreads);
+    std::vector<ParallelEngine> engines;
+    std::vector<PathRelinking> relinkers;
+    std::vector<std::vector<int>> buffers(numThreads); // coloração corrente de cada worker
+    std::vector<WorkerBest> bests(numThreads);
+    engines.reserve(numThreads);
+    relinkers.reserve(numThreads);
+    for (int t = 0; t < numThreads; ++t)
+    {
+        engines.emplace_back(graph, p_param, q_param);
+        engines.back().selection().setSample(rclSampleSize, rclSampleFraction);
+        relinkers.emplace_back(graph, p_param, q_param);
+    }
+
+    // Durante um bloco o conjunto elite é somente leitura
+    ElitePool pool(eliteSize, static_cast<int>(Config::ELITE_MIN_DISTANCE_FRACTION * graph.getNumVertices()));
+    relinkImprovements = 0;
+
+    std::vector<int> bestColoring;
+    int bestIteration = INT_MAX;
+    double sumSolutions = 0.0;
+    iterationsExecuted = 0;
+    // Menor iteração que atingiu o limite inferior (INT_MAX = nenhuma)
+    std::atomic<int> boundIteration(INT_MAX);
+
+    if (!initialSolution.empty())
+    {
+        applyInitialSolution(bestColoring, pool);
+        bestIteration = -1; // empates mantêm a solução inicial
+    }
+
+    int startIteration = 0;
+    if (resumePending)
+    {
+        restoreState(bestColoring, sumSolutions, bestIteration, pool);
+        startIteration = resumeState.nextIteration;
+    }
+
+    std::unique_ptr<CheckpointWriter> writer;
+    if (!checkpointFile.empty())
+        writer.reset(new CheckpointWriter(checkpointFile));
+    auto lastCheckpoint = std::chrono::steady_clock::now();
+
+    for (int blockStart = startIteration; blockStart < totalIterations && boundIteration.load() == INT_MAX && !(incumbent && incumbent->shouldStop());
+         blockStart += blockSize)
+    {
+        if (blockStart > 0)
+        {
+            std::chrono::duration<double> sinceCheckpoint = std::chrono::steady_clock::now() - lastCheckpoint;
+            if (writer && sinceCheckpoint.count() >= checkpointInterval)
+            {
+                ReactiveCheckpoint state = snapshot(blockStart, bestColoring, sumSolutions, bestIteration, pool);
+                state.baseSeed = baseSeed;
+                writer->submit(state.serialize());
+                lastCheckpoint = std::chrono::steady_clock::now();
+            }
+            updateAlphaProbabilities();
+        }
+
+        int blockEnd = std::min(blockStart + blockSize, totalIterations);
+        std::vector<IterationResult> iterationResults(blockEnd - blockStart);
+        std::vector<std::vector<int>> eliteCandidates(eliteSize > 0 ? blockEnd - blockStart : 0);
+        for (WorkerBest &best : bests)
+            best.maxColor = best.iteration = INT_MAX;
+
+        scheduler.parallelFor(blockStart, blockEnd, [&](int iter, int t)
+                              {
+            if (iter > boundIteration.load(std::memory_order_relaxed) || (incumbent && incumbent->shouldStop()))
+                return;
+
+            ParallelEngine &eng = engines[t];
+            std::vector<int> &coloring = buffers[t];
+            IterationResult &res = iterationResults[iter - blockStart];
+
+            eng.rng().seed(baseSeed + 0x9E3779B9u * static_cast<unsigned int>(iter + 1));
+            int alphaIndex = selectAlphaIndex(eng.rng().nextUnit());
+            double alpha = alphaValues[alphaIndex];
+
+            eng.selection().setAlpha(alpha);
+            const std::vector<int> &constructed = eng.construct();
+            coloring.assign(constructed.begin(), constructed.end());
+
+            int maxColor = 0;
+            for (int c : coloring)
+            {
+                maxColor = std::max(maxColor, c);
+            }
+
+            if (eliteSize > 0)
+            {
+                int relinkedMax = relinkers[t].relinkWithPool(coloring, maxColor, pool, eng.rng());
+                if (relinkedMax < maxColor)
+                {
+                    maxColor = relinkedMax;
+                    res.relinked = true;
+                }
+                eliteCandidates[iter - blockStart] = coloring;
+            }
+
+            res.executed = true;
+            res.alphaIndex = alphaIndex;
+            res.maxColor = maxColor;
+
+            // Empate resolvido pela iteração mais antiga, como na versão serial
+            WorkerBest &best = bests[t];
+            if (maxColor < best.maxColor || (maxColor == best.maxColor && iter < best.iteration))
+            {
+                best.maxColor = maxColor;
+                best.iteration = iter;
+                best.alpha = alpha;
+                best.coloring = coloring;
+                if (incumbent)
+                    incumbent->publish(maxColor);
+            }
+
+            if (lowerBound > 0 && maxColor <= lowerBound)
+            {
+                int current = boundIteration.load(std::memory_order_relaxed);
+                while (iter < current &&
+                       !boundIteration.compare_exchange_weak(current, iter, std::memory_order_relaxed))
+                {
+                }
+            } });
+
+        // Redução em ordem de iteração (independente de qual worker executou
+        // cada uma); as posteriores à primeira que atingiu o limite são ignoradas
+        const int lastIteration = boundIteration.load();
+        for (size_t i = 0; i < iterationResults.size(); ++i)
+        {
+            const IterationResult &res = iterationResults[i];
+            if (!res.executed || blockStart + static_cast<int>(i) > lastIteration)
+                continue;
+            alphaRewardSum[res.alphaIndex] += 1.0 / static_cast<double>(std::max(1, res.maxColor));
+            alphaUsageCount[res.alphaIndex] += 1;
+            sumSolutions += res.maxColor;
+            ++iterationsExecuted;
+            if (res.relinked)
+                ++relinkImprovements;
+            if (eliteSize > 0)
+                pool.tryInsert(eliteCandidates[i], res.maxColor);
+        }
+        for (const WorkerBest &best : bests)
+        {
+            if (best.iteration > lastIteration)
+                continue;
+            if (best.maxColor < bestMaxColor ||
+                (best.maxColor == bestMaxColor && best.iteration < bestIteration))
+            {
+                bestMaxColor = best.maxColor;
+                bestIteration = best.iteration;
+                bestAlphaUsed = best.alpha;
+                bestColoring = best.coloring;
+            }
+        }
+    }
+
+    schedulerStats = scheduler.getStats();
+
+    if (writer)
+    {
+        writer->flush();
+        checkpointsWritten = writer->getWritesCompleted();
+    }
+
+    averageSolution = sumSolutions / static_cast<double>(std::max(1, iterationsExecuted));
+
+    return bestColoring;
+}
+
+void ReactiveGRASPAlgorithm::setRCLSample(int size, double fraction)
+{
+    rclSampleSize = size;
+    rclSampleFraction = fraction;
+    engine.selection().setSample(size, fraction);
+}
+
+int ReactiveGRASPAlgorithm::getRCLSampleSize() const
+{
+    const RCLSelection &selection = engine.selection();
+    return selection.isSampled() ? selection.effectiveSampleSize(graph.getNumVertices()) : 0;
+}
+
+void ReactiveGRASPAlgorithm::setRandomSeed(unsigned int seed)
+{
+    hasLocalSeed = true;
+    localSeed = seed;
+    engine.rng().seedLocal(seed);
+}
+
+void ReactiveGRASPAlgorithm::setCheckpoint(const std::string &file, double intervalSeconds, unsigned int seed)
+{
+    checkpointFile = file;
+    checkpointInterval = std::max(0.0, intervalSeconds);
+    checkpointSeed = seed;
+}
+
+bool ReactiveGRASPAlgorithm::resumeFrom(const std::string &file)
+{
+    ReactiveCheckpoint state;
+    if (!state.load(file))
+        return false;
+
+    if (!state.matchesGraph(graph) || state.p != p_param || state.q != q_param ||
+        state.blockSize != blockSize || state.parallel != (numThreads > 1) ||
+        state.eliteSize != eliteSize || state.rclSampleSize != getRCLSampleSize() ||
+        state.initialHash != ReactiveCheckpoint::hashColoring(initialSolution) ||
+        state.alphaValues != alphaValues ||
+        state.alphaProbabilities.size() != alphaValues.size() ||
+        state.alphaRewardSum.size() != alphaValues.size() ||
+        state.alphaUsageCount.size() != alphaValues.size() ||
+        (!state.bestColoring.empty() && static_cast<int>(state.bestColoring.size()) != graph.getNumVertices()))
+    {
+        std::cerr << "Erro: o checkpoint " << file << " não corresponde a esta execução "
+                  << "(grafo, p, q, bloco, alphas, --elite, --rcl-sample, solução inicial de --order/--init "
+                  << "ou modo serial/paralelo)" << std::endl;
+        return false;
+    }
+    if (!state.bestColoring.empty() && !OutputWriter::validateColoring(graph, state.bestColoring, p_param, q_param))
+    {
+        std::cerr << "Erro: a melhor coloração do checkpoint " << file << " não é válida neste grafo" << std::endl;
+        return false;
+    }
+
+    resumeState = std::move(state);
+    resumePending = true;
+    return true;
+}
+
+// Estado em uma fronteira de bloco; a semente/gerador é preenchida por quem chama
+ReactiveCheckpoint ReactiveGRASPAlgorithm::snapshot(int nextIteration, const std::vector<int> &bestColoring,
+                                                    double sumSolutions, int bestIteration,
+                                                    const ElitePool &pool) const
+{
+    ReactiveCheckpoint state;
+    state.describeGraph(graph);
+    state.p = p_param;
+    state.q = q_param;
+    state.blockSize = blockSize;
+    state.parallel = numThreads > 1;
+    state.eliteSize = eliteSize;
+    state.rclSampleSize = getRCLSampleSize();
+    state.initialHash = ReactiveCheckpoint::hashColoring(initialSolution);
+    state.alphaValues = alphaValues;
+    state.nextIteration = nextIteration;
+    state.iterationsExecuted = iterationsExecuted;
+    state.bestMaxColor = bestMaxColor;
+    state.bestIteration = bestIteration;
+    state.relinkImprovements = relinkImprovements;
+    state.sumSolutions = sumSolutions;
+    state.bestAlphaUsed = bestAlphaUsed;
+    state.alphaProbabilities = alphaProbabilities;
+    state.alphaRewardSum = alphaRewardSum;
+    state.alphaUsageCount = alphaUsageCount;
+    state.bestColoring = bestColoring;
+    for (int i = 0; i < pool.size(); ++i)
+        state.elite.emplace_back(pool.memberMaxColor(i), pool.member(i));
+    return state;
+}
+
+void ReactiveGRASPAlgorithm::restoreState(std::vector<int> &bestColoring, double &sumSolutions,
+                                          int &bestIteration, ElitePool &pool)
+{
+    const ReactiveCheckpoint &state = resumeState;
+    iterationsExecuted = state.iterationsExecuted;
+    bestMaxColor = state.bestMaxColor;
+    bestIteration = state.bestIteration;
+    relinkImprovements = state.relinkImprovements;
+    sumSolutions = state.sumSolutions;
+    bestAlphaUsed = state.bestAlphaUsed;
+    alphaProbabilities = state.alphaProbabilities;
+    alphaRewardSum = state.alphaRewardSum;
+    alphaUsageCount = state.alphaUsageCount;
+    bestColoring = state.bestColoring;
+    for (const auto &member : state.elite)
+        pool.restore(member.second, member.first);
+    resumePending = false;
+}
+
+// Partida a quente: a solução inicial é o incumbente e entra no conjunto elite
+void ReactiveGRASPAlgorithm::applyInitialSolution(std::vector<int> &bestColoring, ElitePool &pool)
+{
+    bestColoring = initialSolution;
+    bestMaxColor = *std::max_element(initialSolution.begin(), initialSolution.end());
+    if (eliteSize > 0)
+        pool.tryInsert(initialSolution, bestMaxColor);
+    if (incumbent)
+        incumbent->publish(bestMaxColor);
+}
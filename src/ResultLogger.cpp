@@ -1,4 +1,6 @@
 #include "../include/ResultLogger.h"
+#include "../include/LowerBound.h"
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -7,8 +9,14 @@
 #include <sys/stat.h>
 
 ResultLogger::ResultLogger(const std::string &csvFilename)
-    : filename(csvFilename), headerWritten(false)
+    : filename(csvFilename), headerWritten(false), writable(true)
 {
+    // Um CSV com colunas de outra versão é renomeado antes; se não der, nada é gravado
+    if (fileExists(filename) && !rotateIfStale())
+    {
+        writable = false;
+        return;
+    }
 
     // Verifica se o arquivo existe para decidir se escreve o cabeçalho
     headerWritten = fileExists(filename);
@@ -26,6 +34,46 @@ bool ResultLogger::fileExists(const std::string &filename)
     return (stat(filename.c_str(), &buffer) == 0);
 }
 
+const std::string &ResultLogger::header()
+{
+    static const std::string columns =
+        "data_hora,instancia,p,q,algoritmo,alpha,iteracoes,tamanho_bloco,"
+        "semente,tempo_execucao_s,melhor_solucao,melhor_alpha,media_solucoes,"
+        "limite_inferior,gap,amostra_rcl";
+    return columns;
+}
+
+bool ResultLogger::rotateIfStale()
+{
+    std::string firstLine;
+    {
+        std::ifstream file(filename);
+        std::getline(file, firstLine);
+    }
+    if (!firstLine.empty() && firstLine.back() == '\r')
+        firstLine.pop_back();
+    if (firstLine == header())
+        return true;
+
+    // resultados.csv -> resultados.antigo-AAAAMMDD-HHMMSS.csv
+    auto time_t_now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::stringstream ss;
+    ss << std::put_time(std::localtime(&time_t_now), "%Y%m%d-%H%M%S");
+    const std::string stamp = ss.str();
+    size_t dot = filename.rfind('.');
+    size_t slash = filename.rfind('/');
+    bool hasExtension = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+    std::string rotated = hasExtension ? filename.substr(0, dot) + ".antigo-" + stamp + filename.substr(dot)
+                                       : filename + ".antigo-" + stamp;
+    if (std::rename(filename.c_str(), rotated.c_str()) != 0)
+    {
+        std::cerr << "Erro: " << filename << " tem cabeçalho de outra versão e não pôde ser renomeado" << std::endl;
+        return false;
+    }
+    std::cout << "[AVISO] " << filename << " tinha colunas de outra versão; movido para " << rotated << std::endl;
+    return true;
+}
+
 void ResultLogger::writeHeader()
 {
     std::ofstream file(filename, std::ios::app);
@@ -35,8 +83,7 @@ void ResultLogger::writeHeader()
         return;
     }
 
-    file << "data_hora,instancia,p,q,algoritmo,alpha,iteracoes,tamanho_bloco,"
-         << "semente,tempo_execucao_s,melhor_solucao,melhor_alpha,media_solucoes" << std::endl;
+    file << header() << std::endl;
 
     file.close();
     headerWritten = true;
@@ -62,8 +109,13 @@ bool ResultLogger::logResult(const std::string &instance,
                              double executionTime,
                              int bestSolution,
                              double bestAlpha,
-                             double averageSolution)
+                             double averageSolution,
+                             int lowerBound,
+                             int rclSample)
 {
+    if (!writable)
+        return false;
+
     std::ofstream file(filename, std::ios::app);
     if (!file.is_open())
     {
@@ -73,6 +125,9 @@ bool ResultLogger::logResult(const std::string &instance,
 
     std::string timestamp = getCurrentTimestamp();
 
+    // "portfolio/<vencedor>": as colunas seguem o algoritmo vencedor
+    const std::string baseAlgorithm = algorithm.substr(algorithm.find('/') + 1);
+
     file << std::fixed << std::setprecision(6);
 
     file << timestamp << ","
@@ -82,17 +137,17 @@ bool ResultLogger::logResult(const std::string &instance,
          << algorithm << ",";
 
     // Alpha: relevante apenas para GRASP (não reativo)
-    if (algorithm == "grasp")
+    if (baseAlgorithm == "grasp")
         file << alpha;
     file << ",";
 
-    // Iterações: relevante para GRASP e Reativo
-    if (algorithm == "grasp" || algorithm == "reactive")
+    // Iterações: relevante para GRASP, Reativo e Tabu
+    if (baseAlgorithm == "grasp" || baseAlgorithm == "reactive" || baseAlgorithm == "tabu")
         file << iterations;
     file << ",";
 
     // Tamanho do bloco: relevante apenas para Reativo
-    if (algorithm == "reactive")
+    if (baseAlgorithm == "reactive")
         file << blockSize;
     file << ",";
 
@@ -101,13 +156,25 @@ bool ResultLogger::logResult(const std::string &instance,
          << bestSolution << ",";
 
     // Melhor alpha: relevante apenas para Reativo
-    if (algorithm == "reactive" && bestAlpha >= 0)
+    if (baseAlgorithm == "reactive" && bestAlpha >= 0)
         file << bestAlpha;
     file << ",";
 
     // Média das soluções: relevante para GRASP e Reativo
-    if ((algorithm == "grasp" || algorithm == "reactive") && averageSolution >= 0)
+    if ((baseAlgorithm == "grasp" || baseAlgorithm == "reactive") && averageSolution >= 0)
         file << std::setprecision(2) << averageSolution;
+    file << ",";
+
+    // Limite inferior e gap relativo (melhor - limite) / limite
+    if (lowerBound > 0)
+        file << lowerBound << "," << std::setprecision(4) << LowerBound::gap(bestSolution, lowerBound);
+    else
+        file << ",";
+    file << ",";
+
+    // Amostra da RCL: relevante para GRASP e Reativo no modo amostrado
+    if ((baseAlgorithm == "grasp" || baseAlgorithm == "reactive") && rclSample > 0)
+        file << rclSample;
 
     file << std::endl;
 
@@ -0,0 +1,340 @@
+#include "../include/Solver.h"
+#include "../include/GreedyAlgorithm.h"
+#include "../include/GRASPAlgorithm.h"
+#include "../include/ReactiveGRASPAlgorithm.h"
+#include "../include/TabuSearchAlgorithm.h"
+#include "../include/BranchAndBoundAlgorithm.h"
+#include "../include/DSaturAlgorithm.h"
+#include "../include/CompactGraph.h"
+#include "../include/VertexOrdering.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+    /**
+     * Esta é apenas uma coloração trivial para testar o sistema de I/O
+     */
+    std::vector<int> exampleColoring(const Graph &graph, int p, int q)
+    {
+        int n = graph.getNumVertices();
+        std::vector<int> coloring(n);
+
+        int spacing = std::max(p, q);
+        for (int i = 0; i < n; i++)
+        {
+            coloring[i] = i * spacing;
+        }
+
+        return coloring;
+    }
+
+    /**
+     * Ordem de options.order (não vazia), registrada no log
+     */
+    std::vector<int> vertexOrder(const Graph &graph, const SolverOptions &options, std::ostream &log)
+    {
+        // A semente da ordem aleatória só é sorteada quando ela é pedida
+        unsigned int seed = 0;
+        if (options.order == Config::ORDER_RANDOM)
+            seed = options.randomSeed != 0 ? options.randomSeed : static_cast<unsigned int>(std::rand());
+        int degeneracy = -1;
+        std::vector<int> order = VertexOrdering::compute(graph, options.order, seed, &degeneracy);
+        log << "[INFO] Ordem dos vértices: " << options.order;
+        if (degeneracy >= 0)
+            log << " (degenerescência de G²: " << degeneracy << ")";
+        log << std::endl;
+        return order;
+    }
+
+    /**
+     * Guloso na ordem de options.order (grau decrescente se vazia)
+     */
+    std::vector<int> orderedGreedy(const Graph &graph, const SolverOptions &options, std::ostream &log)
+    {
+        if (options.order.empty())
+        {
+            GreedyAlgorithm greedy(graph, options.p, options.q);
+            return greedy.solve();
+        }
+
+        GreedyAlgorithm greedy(graph, options.p, options.q, vertexOrder(graph, options, log));
+        return greedy.solve();
+    }
+
+    /**
+     * Solução inicial do GRASP: a fornecida ou, com --order, o guloso nessa ordem
+     */
+    std::vector<int> graspSeed(const Graph &graph, const SolverOptions &options, std::ostream &log)
+    {
+        if (!options.initialColoring.empty() || options.order.empty())
+            return options.initialColoring;
+        std::vector<int> seed = orderedGreedy(graph, options, log);
+        if (!seed.empty())
+        {
+            log << "[INFO] Solução inicial: guloso (maior cor "
+                << *std::max_element(seed.begin(), seed.end()) << ")" << std::endl;
+        }
+        return seed;
+    }
+}
+
+SolverResult Solver::run(const Graph &graph, const SolverOptions &options)
+{
+    // Sem verbose, as mensagens vão para um stream sem buffer (descartadas)
+    std::ostream quiet(nullptr);
+    std::ostream &log = options.verbose ? std::cout : quiet;
+
+    const int p = options.p;
+    const int q = options.q;
+    const int iterations = options.iterations;
+    const std::vector<int> &initialColoring = options.initialColoring;
+
+    SolverResult result;
+    std::vector<int> &coloring = result.coloring;
+
+    if (options.algorithm == Config::ALGORITHM_GREEDY)
+    {
+        log << "[INFO] Executando algoritmo guloso (greedy)..." << std::endl;
+        if (options.compactWidth >= 0)
+        {
+            int indexBits, colorBits;
+            if (!CompactGraph::chooseWidths(graph, p, q, options.compactWidth, indexBits, colorBits))
+            {
+                std::cerr << "Erro: largura de " << options.compactWidth << " bits não comporta a instância (n = "
+                          << graph.getNumVertices() << ", limite de cor " << CompactGraph::colorBound(graph, p, q)
+                          << ")" << std::endl;
+                result.ok = false;
+                return result;
+            }
+            log << "[INFO] Vizinhanças compactas: ids de " << indexBits << " bits, cores de " << colorBits
+                << " bits" << std::endl;
+            std::vector<int> order = options.order.empty() ? VertexOrdering::byDegree(graph)
+                                                           : vertexOrder(graph, options, log);
+            coloring = CompactGraph::greedy(graph, p, q, indexBits, colorBits, order);
+        }
+        else
+        {
+            coloring = orderedGreedy(graph, options, log);
+        }
+    }
+    else if (options.algorithm == Config::ALGORITHM_DSATUR)
+    {
+        log << "[INFO] Executando guloso por saturação (dsatur)..." << std::endl;
+        DSaturAlgorithm dsatur(graph, p, q);
+        coloring = dsatur.solve();
+        log << "[INFO] Entradas retiradas do heap: " << dsatur.getHeapPops() << " (" << graph.getNumVertices()
+            << " vértices)" << std::endl;
+    }
+    else if (options.algorithm == Config::ALGORITHM_GRASP)
+    {
+        log << "[INFO] Executando GRASP (alpha=" << options.alpha << ", iter=" << iterations
+            << ", threads=" << options.numThreads << ")..." << std::endl;
+        GRASPAlgorithm grasp(graph, p, q, options.alpha, iterations);
+        grasp.setLowerBound(options.lowerBound);
+        grasp.setNumThreads(options.numThreads);
+        grasp.setEliteSize(options.eliteSize);
+        if (options.numThreads > 1 && options.eliteSize > 0)
+        {
+            log << "[AVISO] GRASP com conjunto elite executa em série (a ordem de inserção no conjunto é sequencial)" << std::endl;
+        }
+        grasp.setRCLSample(options.rclSampleCount, options.rclSampleFraction);
+        if (options.randomSeed != 0)
+        {
+            grasp.setRandomSeed(options.randomSeed);
+        }
+        grasp.setIncumbent(options.incumbent);
+        std::vector<int> seedColoring = graspSeed(graph, options, log);
+        if (!seedColoring.empty())
+        {
+            grasp.setInitialSolution(seedColoring);
+        }
+        result.rclSampleSize = grasp.getRCLSampleSize();
+        if (result.rclSampleSize > 0)
+        {
+            log << "[INFO] RCL amostrada: " << result.rclSampleSize << " vértices por passo" << std::endl;
+        }
+        coloring = grasp.solve();
+        result.averageSolution = grasp.getAverageSolution();
+        if (!grasp.getSchedulerStats().empty())
+        {
+            log << "[INFO] Escalonador (roubo de trabalho):" << std::endl;
+            WorkStealingScheduler::printStats(grasp.getSchedulerStats(), log, "  ");
+        }
+        if (options.eliteSize > 0)
+        {
+            log << "[INFO] Religamentos com melhora: " << grasp.getRelinkImprovements() << std::endl;
+        }
+        if (grasp.getIterationsExecuted() < iterations)
+        {
+            log << "[INFO] Limite inferior atingido após " << grasp.getIterationsExecuted()
+                << " iterações (solução ótima)" << std::endl;
+        }
+    }
+    else if (options.algorithm == Config::ALGORITHM_REACTIVE)
+    {
+        log << "[INFO] Executando GRASP reativo (alphas=";
+        for (size_t i = 0; i < Config::DEFAULT_REACTIVE_ALPHAS.size(); ++i)
+        {
+            log << Config::DEFAULT_REACTIVE_ALPHAS[i];
+            if (i + 1 < Config::DEFAULT_REACTIVE_ALPHAS.size())
+                log << ",";
+        }
+        log << ", bloco=" << options.blockSize << ", iter=" << iterations
+            << ", threads=" << options.numThreads << ")..." << std::endl;
+
+        ReactiveGRASPAlgorithm reactive(graph, p, q,
+                                        Config::DEFAULT_REACTIVE_ALPHAS,
+                                        options.blockSize,
+                                        iterations);
+        reactive.setLowerBound(options.lowerBound);
+        reactive.setNumThreads(options.numThreads);
+        reactive.setEliteSize(options.eliteSize);
+        reactive.setRCLSample(options.rclSampleCount, options.rclSampleFraction);
+        if (options.randomSeed != 0)
+        {
+            reactive.setRandomSeed(options.randomSeed);
+        }
+        reactive.setIncumbent(options.incumbent);
+        std::vector<int> seedColoring = graspSeed(graph, options, log);
+        if (!seedColoring.empty())
+        {
+            reactive.setInitialSolution(seedColoring);
+        }
+        if (!options.checkpointFile.empty())
+        {
+            reactive.setCheckpoint(options.checkpointFile, options.checkpointInterval, options.checkpointSeed);
+            if (options.resume)
+            {
+                if (!reactive.resumeFrom(options.checkpointFile))
+                {
+                    result.ok = false;
+                    return result;
+                }
+                log << "[INFO] Retomando do checkpoint " << options.checkpointFile << std::endl;
+            }
+        }
+        result.rclSampleSize = reactive.getRCLSampleSize();
+        if (result.rclSampleSize > 0)
+        {
+            log << "[INFO] RCL amostrada: " << result.rclSampleSize << " vértices por passo" << std::endl;
+        }
+        coloring = reactive.solve();
+        if (!reactive.getSchedulerStats().empty())
+        {
+            log << "[INFO] Escalonador (roubo de trabalho):" << std::endl;
+            WorkStealingScheduler::printStats(reactive.getSchedulerStats(), log, "  ");
+        }
+        if (options.eliteSize > 0)
+        {
+            log << "[INFO] Religamentos com melhora: " << reactive.getRelinkImprovements() << std::endl;
+        }
+        if (reactive.getIterationsExecuted() < iterations)
+        {
+            log << "[INFO] Limite inferior atingido após " << reactive.getIterationsExecuted()
+                << " iterações (solução ótima)" << std::endl;
+        }
+        if (!options.checkpointFile.empty())
+        {
+            log << "[INFO] Checkpoints gravados: " << reactive.getCheckpointsWritten() << std::endl;
+        }
+        result.bestAlphaUsed = reactive.getBestAlphaUsed();
+        result.averageSolution = reactive.getAverageSolution();
+    }
+    else if (options.algorithm == Config::ALGORITHM_TABU)
+    {
+        std::vector<int> initial;
+        if (!initialColoring.empty())
+        {
+            log << "[INFO] Solução inicial: " << options.initialLabel << std::endl;
+            initial = initialColoring;
+        }
+        else if (options.tabuInit == Config::ALGORITHM_GRASP)
+        {
+            log << "[INFO] Solução inicial: GRASP (alpha=" << options.alpha
+                << ", iter=" << Config::DEFAULT_ITERATIONS << ")..." << std::endl;
+            GRASPAlgorithm grasp(graph, p, q, options.alpha, Config::DEFAULT_ITERATIONS);
+            grasp.setLowerBound(options.lowerBound);
+            if (options.randomSeed != 0)
+            {
+                grasp.setRandomSeed(options.randomSeed);
+            }
+            initial = grasp.solve();
+        }
+        else
+        {
+            log << "[INFO] Solução inicial: guloso..." << std::endl;
+            initial = orderedGreedy(graph, options, log);
+        }
+        log << "[INFO] Maior cor inicial: " << *std::max_element(initial.begin(), initial.end()) << std::endl;
+
+        log << "[INFO] Executando busca tabu (iter sem melhora por span=" << iterations << ")..." << std::endl;
+        TabuSearchAlgorithm tabu(graph, p, q, iterations);
+        tabu.setLowerBound(options.lowerBound);
+        tabu.setIncumbent(options.incumbent);
+        if (options.randomSeed != 0)
+        {
+            // Sequência distinta da usada pelo GRASP inicial
+            tabu.setRandomSeed(options.randomSeed ^ 0x5bd1e995u);
+        }
+        coloring = tabu.solve(initial);
+        log << "[INFO] Iterações tabu: " << tabu.getTotalIterations() << std::endl;
+    }
+    else if (options.algorithm == Config::ALGORITHM_EXACT)
+    {
+        // Limite superior inicial: solução fornecida ou guloso
+        std::vector<int> initial = initialColoring;
+        if (initial.empty())
+        {
+            initial = orderedGreedy(graph, options, log);
+        }
+        if (!initial.empty())
+        {
+            log << "[INFO] Maior cor inicial: " << *std::max_element(initial.begin(), initial.end()) << std::endl;
+        }
+
+        log << "[INFO] Executando branch-and-bound exato (limite de nós=" << options.nodeLimit
+            << ", tempo máximo=" << options.timeLimit << "s)..." << std::endl;
+        BranchAndBoundAlgorithm exact(graph, p, q);
+        exact.setLowerBound(options.lowerBound);
+        exact.setNodeLimit(options.nodeLimit);
+        exact.setTimeLimit(options.timeLimit);
+        exact.setIncumbent(options.incumbent);
+        coloring = exact.solve(initial);
+
+        const double seconds = exact.getSeconds();
+        log << "[INFO] Nós explorados: " << exact.getNodes() << " em " << seconds << " segundos ("
+            << (seconds > 0 ? exact.getNodes() / seconds : 0.0) << " nós/s)" << std::endl;
+        if (exact.isProven())
+        {
+            log << "[INFO] Ótimo provado: maior cor " << exact.getBestBound() << std::endl;
+        }
+        else
+        {
+            log << "[INFO] Busca interrompida; melhor limite inferior provado: " << exact.getBestBound() << std::endl;
+        }
+        result.provenBound = exact.getBestBound();
+    }
+    else
+    {
+        log << "[AVISO] Algoritmo solicitado não implementado; usando coloração de exemplo." << std::endl;
+        coloring = exampleColoring(graph, p, q);
+    }
+
+    // A solução inicial é o incumbente de qualquer algoritmo
+    if (!initialColoring.empty() && !coloring.empty() &&
+        *std::max_element(initialColoring.begin(), initialColoring.end()) <
+            *std::max_element(coloring.begin(), coloring.end()))
+    {
+        log << "[INFO] Solução inicial mantida (melhor que a encontrada)" << std::endl;
+        coloring = initialColoring;
+    }
+
+    if (options.incumbent && !coloring.empty())
+    {
+        options.incumbent->publish(*std::max_element(coloring.begin(), coloring.end()));
+    }
+
+    return result;
+}
@@ -0,0 +1,561 @@
+#include "../include/SolverDaemon.h"
+#include "../include/Config.h"
+#include "../include/LowerBound.h"
+#include "../include/OutputWriter.h"
+#include "../include/Portfolio.h"
+#include "../include/Solver.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    /**
+     * Leitura dos campos de uma requisição com valores padrão; guarda o
+     * primeiro erro de tipo encontrado.
+     */
+    struct RequestReader
+    {
+        const std::map<std::string, JsonLine::Value> &fields;
+        std::string error;
+
+        const JsonLine::Value *find(const std::string &name, JsonLine::Value::Type type)
+        {
+            auto it = fields.find(name);
+            if (it == fields.end() || it->second.type == JsonLine::Value::Type::Null)
+                return nullptr;
+            if (it->second.type != type)
+            {
+                if (error.empty())
+                    error = "tipo inválido no campo \"" + name + "\"";
+                return nullptr;
+            }
+            return &it->second;
+        }
+        double number(const std::string &name, double fallback)
+        {
+            const JsonLine::Value *v = find(name, JsonLine::Value::Type::Number);
+            return v ? std::atof(v->text.c_str()) : fallback;
+        }
+        // Número JSON inteiro (1e1 vale 10) dentro de [lo, hi]; senão, erro
+        long long whole(const std::string &name, long long fallback, long long lo, long long hi)
+        {
+            const JsonLine::Value *v = find(name, JsonLine::Value::Type::Number);
+            if (!v)
+                return fallback;
+            char *end = nullptr;
+            double value = std::strtod(v->text.c_str(), &end);
+            if (end == v->text.c_str() || *end != '\0' || !std::isfinite(value) || value != std::floor(value) ||
+                value < static_cast<double>(lo) || value > static_cast<double>(hi))
+            {
+                if (error.empty())
+                    error = "campo \"" + name + "\" deve ser um inteiro";
+                return fallback;
+            }
+            return static_cast<long long>(value);
+        }
+        int integer(const std::string &name, int fallback)
+        {
+            return static_cast<int>(whole(name, fallback, INT_MIN, INT_MAX));
+        }
+        std::string text(const std::string &name, const std::string &fallback)
+        {
+            const JsonLine::Value *v = find(name, JsonLine::Value::Type::String);
+            return v ? v->text : fallback;
+        }
+        bool flag(const std::string &name, bool fallback)
+        {
+            const JsonLine::Value *v = find(name, JsonLine::Value::Type::Bool);
+            return v ? v->boolean : fallback;
+        }
+    };
+
+    std::string idOf(const std::map<std::string, JsonLine::Value> &fields)
+    {
+        auto it = fields.find("id");
+        return it != fields.end() ? it->second.raw() : "null";
+    }
+
+    std::string errorLine(const std::string &id, const std::string &message)
+    {
+        return JsonBuilder().addRaw("id", id).add("ok", false).add("error", message).line();
+    }
+
+    void printServeUsage(const char *programName)
+    {
+        std::cerr << "\nUso: " << programName << " serve [--socket <caminho>] [--cache <n>] [--workers <n>]" << std::endl;
+        std::cerr << "  --socket <caminho> Escuta em um socket Unix (padrão: entrada/saída padrão)" << std::endl;
+        std::cerr << "  --cache <n>        Grafos mantidos em memória (padrão: " << Config::DEFAULT_CACHE_GRAPHS << ")" << std::endl;
+        std::cerr << "  --workers <n>      Requisições resolvidas em paralelo (0 = todos os núcleos; padrão: 0)" << std::endl;
+        std::cerr << "\nUma requisição JSON por linha, ex.:" << std::endl;
+        std::cerr << "  {\"id\":1,\"graph\":\"instances/dimacs/dsjc125.1.col\",\"algorithm\":\"grasp\",\"seed\":5}" << std::endl;
+    }
+}
+
+SolverDaemon::Connection::~Connection()
+{
+    if (ownsFd)
+        ::close(inFd);
+}
+
+void SolverDaemon::Connection::send(const std::string &line)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    size_t written = 0;
+    while (written < line.size())
+    {
+        ssize_t r = ::write(outFd, line.data() + written, line.size() - written);
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r <= 0)
+            return; // cliente desconectado: a resposta é descartada
+        written += static_cast<size_t>(r);
+    }
+}
+
+SolverDaemon::SolverDaemon(size_t cacheCapacity, int numWorkers)
+    : cache(cacheCapacity), draining(false), shutdownRequested(false),
+      served(0), failed(0), seedCounter(0), listenFd(-1)
+{
+    if (numWorkers <= 0)
+        numWorkers = std::max(1u, std::thread::hardware_concurrency());
+    for (int t = 0; t < numWorkers; ++t)
+        workers.emplace_back(&SolverDaemon::workerLoop, this);
+}
+
+SolverDaemon::~SolverDaemon()
+{
+    stopWorkers();
+}
+
+void SolverDaemon::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        draining = true;
+    }
+    queueReady.notify_all();
+    for (auto &th : workers)
+        th.join();
+    workers.clear();
+}
+
+void SolverDaemon::requestShutdown()
+{
+    shutdownRequested = true;
+    if (listenFd >= 0)
+        ::shutdown(listenFd, SHUT_RDWR); // desbloqueia o accept
+}
+
+void SolverDaemon::readLoop(const std::shared_ptr<Connection> &connection)
+{
+    std::string pending;
+    char buffer[65536];
+    while (!shutdownRequested)
+    {
+        ssize_t r = ::read(connection->inFd, buffer, sizeof(buffer));
+        if (r < 0 && errno == EINTR)
+            continue;
+        if (r <= 0)
+            break;
+        pending.append(buffer, static_cast<size_t>(r));
+
+        size_t start = 0, end;
+        while ((end = pending.find('\n', start)) != std::string::npos && !shutdownRequested)
+        {
+            std::string line = pending.substr(start, end - start);
+            start = end + 1;
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (line.find_first_not_of(" \t") != std::string::npos)
+                handleLine(connection, line);
+        }
+        pending.erase(0, start);
+    }
+}
+
+void SolverDaemon::handleLine(const std::shared_ptr<Connection> &connection, const std::string &line)
+{
+    Job job;
+    std::string error;
+    if (!JsonLine::parseObject(line, job.fields, error))
+    {
+        ++failed;
+        connection->send(errorLine("null", "JSON inválido: " + error));
+        return;
+    }
+
+    // Comandos são respondidos na hora, sem passar pela fila
+    auto command = job.fields.find("command");
+    if (command != job.fields.end())
+    {
+        const std::string id = idOf(job.fields);
+        if (command->second.text == "stats")
+        {
+            connection->send(statsLine(id));
+        }
+        else if (command->second.text == "shutdown")
+        {
+            connection->send(JsonBuilder().addRaw("id", id).add("ok", true).add("command", "shutdown").line());
+            requestShutdown();
+        }
+        else
+        {
+            ++failed;
+            connection->send(errorLine(id, "comando desconhecido: " + command->second.text));
+        }
+        return;
+    }
+
+    job.connection = connection;
+    job.received = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back(std::move(job));
+    }
+    queueReady.notify_one();
+}
+
+void SolverDaemon::workerLoop()
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]
+                            { return !queue.empty() || draining; });
+            if (queue.empty())
+                return;
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+
+        std::chrono::duration<double> waited = std::chrono::steady_clock::now() - job.received;
+        std::string response;
+        try
+        {
+            response = solve(job.fields, waited.count());
+        }
+        catch (const std::exception &e)
+        {
+            ++failed;
+            response = errorLine(idOf(job.fields), std::string("falha na resolução: ") + e.what());
+        }
+        job.connection->send(response);
+    }
+}
+
+std::string SolverDaemon::solve(const std::map<std::string, JsonLine::Value> &fields, double queueSeconds)
+{
+    const std::string id = idOf(fields);
+    RequestReader request{fields, ""};
+
+    const std::string graphFile = request.text("graph", "");
+    SolverOptions options;
+    options.verbose = false;
+    options.algorithm = request.text("algorithm", Config::ALGORITHM_GREEDY);
+    options.p = request.integer("p", Config::DEFAULT_P);
+    options.q = request.integer("q", Config::DEFAULT_Q);
+    options.alpha = request.number("alpha", Config::DEFAULT_ALPHA);
+    options.eliteSize = request.integer("elite", Config::DEFAULT_ELITE_SIZE);
+    options.numThreads = std::max(1, request.integer("threads", Config::DEFAULT_THREADS));
+    options.tabuInit = request.text("tabu_init", Config::ALGORITHM_GREEDY);
+    double rclSample = request.number("rcl_sample", Config::DEFAULT_RCL_SAMPLE);
+    options.rclSampleCount = rclSample >= 1.0 ? static_cast<int>(rclSample) : 0;
+    options.rclSampleFraction = rclSample >= 1.0 ? 0.0 : rclSample;
+
+    // Iterações e bloco ausentes usam o padrão de cada algoritmo, como na linha de comando
+    const int iterations = request.integer("iterations", 0);
+    const int blockSize = request.integer("block", 0);
+    if (options.algorithm == Config::ALGORITHM_REACTIVE)
+        options.iterations = iterations > 0 ? iterations : Config::DEFAULT_REACTIVE_ITERATIONS;
+    else if (options.algorithm == Config::ALGORITHM_TABU)
+        options.iterations = iterations > 0 ? iterations : Config::DEFAULT_TABU_ITERATIONS;
+    else
+        options.iterations = iterations > 0 ? iterations : Config::DEFAULT_ITERATIONS;
+    options.blockSize = blockSize > 0 ? blockSize : Config::DEFAULT_BLOCK_SIZE_GRASPR;
+
+    // Sempre um gerador próprio: std::rand não pode ser compartilhado entre requisições
+    unsigned int seed = static_cast<unsigned int>(request.whole("seed", 0, 0, UINT_MAX));
+    if (seed == 0)
+    {
+        seed = static_cast<unsigned int>(std::chrono::steady_clock::now().time_since_epoch().count()) ^
+               (0x9E3779B9u * ++seedCounter);
+        if (seed == 0)
+            seed = 1;
+    }
+    options.randomSeed = seed;
+
+    const std::string portfolioSpec = request.text("portfolio", Config::DEFAULT_PORTFOLIO);
+    const double timeLimit = request.number("time_limit", Config::DEFAULT_TIME_LIMIT);
+    options.timeLimit = timeLimit;
+    options.nodeLimit = static_cast<long long>(
+        request.number("node_limit", static_cast<double>(Config::DEFAULT_EXACT_NODE_LIMIT)));
+    const bool wantColoring = request.flag("coloring", false);
+    const bool wantValidation = request.flag("validate", false);
+
+    if (request.error.empty())
+    {
+        if (graphFile.empty())
+            request.error = "campo \"graph\" obrigatório";
+        else if (options.algorithm != Config::ALGORITHM_GREEDY && options.algorithm != Config::ALGORITHM_GRASP &&
+                 options.algorithm != Config::ALGORITHM_REACTIVE && options.algorithm != Config::ALGORITHM_TABU &&
+                 options.algorithm != Config::ALGORITHM_EXACT && options.algorithm != Config::ALGORITHM_DSATUR &&
+                 options.algorithm != Config::ALGORITHM_PORTFOLIO)
+            request.error = "algoritmo desconhecido: " + options.algorithm;
+        else if (options.p < 0 || options.q < 0)
+            request.error = "p e q devem ser não negativos";
+        else if (options.alpha < Config::MIN_ALPHA || options.alpha > Config::MAX_ALPHA)
+            request.error = "alpha fora de [0, 1]";
+    }
+    if (!request.error.empty())
+    {
+        ++failed;
+        return errorLine(id, request.error);
+    }
+
+    bool cached = false;
+    std::string error;
+    GraphCache::Entry entry = cache.get(graphFile, cached, error);
+    if (!entry.graph)
+    {
+        ++failed;
+        return errorLine(id, error);
+    }
+    const Graph &graph = *entry.graph;
+
+    auto solveStart = std::chrono::steady_clock::now();
+    options.lowerBound = LowerBound::compute(graph, options.p, options.q);
+
+    SolverResult result;
+    std::string label = options.algorithm;
+    if (graph.getNumVertices() == 0)
+    {
+        // Nada a colorir
+    }
+    else if (options.algorithm == Config::ALGORITHM_PORTFOLIO)
+    {
+        SolverOptions base = options;
+        std::vector<Portfolio::Entry> entries;
+        if (!Portfolio::parse(portfolioSpec, base, iterations, blockSize, entries))
+        {
+            ++failed;
+            return errorLine(id, "portfólio inválido: " + portfolioSpec);
+        }
+        Portfolio portfolio(graph, std::move(entries));
+        portfolio.setBaseSeed(seed);
+        result = portfolio.run(options.numThreads, options.lowerBound, timeLimit);
+        if (portfolio.getWinner() >= 0)
+            label += "/" + portfolio.getEntries()[portfolio.getWinner()].label;
+    }
+    else
+    {
+        result = Solver::run(graph, options);
+    }
+    std::chrono::duration<double> solveTime = std::chrono::steady_clock::now() - solveStart;
+
+    if (!result.ok || (graph.getNumVertices() > 0 && result.coloring.empty()))
+    {
+        ++failed;
+        return errorLine(id, "nenhuma solução encontrada");
+    }
+
+    const std::vector<int> &coloring = result.coloring;
+    int maxColor = coloring.empty() ? 0 : *std::max_element(coloring.begin(), coloring.end());
+
+    JsonBuilder response;
+    response.addRaw("id", id)
+        .add("ok", true)
+        .add("graph", graphFile)
+        .add("vertices", graph.getNumVertices())
+        .add("algorithm", label)
+        .add("seed", static_cast<long long>(seed))
+        .add("max_color", maxColor)
+        .add("span", std::max(0, maxColor - 1))
+        .add("lower_bound", std::max(options.lowerBound, result.provenBound))
+        .add("cached", cached)
+        .add("load_seconds", cached ? 0.0 : entry.loadSeconds)
+        .add("index_seconds", cached ? 0.0 : entry.indexSeconds)
+        .add("queue_seconds", queueSeconds)
+        .add("solve_seconds", solveTime.count());
+    if (wantValidation)
+        response.add("valid", OutputWriter::validateColoring(graph, coloring, options.p, options.q));
+    if (wantColoring)
+        response.add("coloring", coloring);
+
+    ++served;
+    return response.line();
+}
+
+std::string SolverDaemon::statsLine(const std::string &id)
+{
+    size_t queued;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queued = queue.size();
+    }
+    return JsonBuilder()
+        .addRaw("id", id)
+        .add("ok", true)
+        .add("served", static_cast<long long>(served))
+        .add("failed", static_cast<long long>(failed))
+        .add("queued", static_cast<long long>(queued))
+        .add("workers", static_cast<int>(workers.size()))
+        .add("cache_entries", static_cast<long long>(cache.getSize()))
+        .add("cache_capacity", static_cast<long long>(cache.getCapacity()))
+        .add("cache_hits", static_cast<long long>(cache.getHits()))
+        .add("cache_misses", static_cast<long long>(cache.getMisses()))
+        .line();
+}
+
+int SolverDaemon::serveStream(int inFd, int outFd)
+{
+    auto connection = std::make_shared<Connection>(inFd, outFd, false);
+    readLoop(connection);
+    stopWorkers(); // termina o que já estava na fila
+    return 0;
+}
+
+int SolverDaemon::serveSocket(const std::string &path)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        std::cerr << "Erro: caminho do socket muito longo: " << path << std::endl;
+        return 1;
+    }
+    std::strcpy(address.sun_path, path.c_str());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        std::cerr << "Erro: não foi possível criar o socket: " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    ::unlink(path.c_str()); // socket de uma execução anterior
+    if (::bind(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || ::listen(fd, 64) != 0)
+    {
+        std::cerr << "Erro: não foi possível escutar em " << path << ": " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return 1;
+    }
+    listenFd = fd;
+    std::cerr << "[INFO] Servidor escutando em " << path << " (" << workers.size() << " workers, cache de "
+              << cache.getCapacity() << " grafos)" << std::endl;
+
+    // Uma thread de leitura por conexão; as respostas saem pelos workers
+    std::mutex readersMutex;
+    std::condition_variable readersDone;
+    int activeReaders = 0;
+
+    while (!shutdownRequested)
+    {
+        int client = ::accept(fd, nullptr, nullptr);
+        if (client < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        auto connection = std::make_shared<Connection>(client, client, true);
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            connections.erase(std::remove_if(connections.begin(), connections.end(),
+                                             [](const std::weak_ptr<Connection> &c)
+                                             { return c.expired(); }),
+                              connections.end());
+            connections.push_back(connection);
+        }
+        {
+            std::lock_guard<std::mutex> lock(readersMutex);
+            ++activeReaders;
+        }
+        std::thread([this, connection, &readersMutex, &readersDone, &activeReaders]() mutable
+                    {
+                        readLoop(connection);
+                        connection.reset();
+                        std::lock_guard<std::mutex> lock(readersMutex);
+                        --activeReaders;
+                        readersDone.notify_all();
+                    })
+            .detach();
+    }
+
+    // Encerra a leitura das conexões abertas; respostas pendentes ainda são enviadas
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (auto &weak : connections)
+        {
+            if (auto connection = weak.lock())
+                ::shutdown(connection->inFd, SHUT_RD);
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock(readersMutex);
+        readersDone.wait(lock, [&activeReaders]
+                         { return activeReaders == 0; });
+    }
+    stopWorkers();
+
+    listenFd = -1;
+    ::close(fd);
+    ::unlink(path.c_str());
+    std::cerr << "[INFO] Servidor encerrado (" << served << " requisições atendidas, " << failed
+              << " com erro)" << std::endl;
+    return 0;
+}
+
+int SolverDaemon::runCommand(int argc, char *argv[])
+{
+    std::string socketPath;
+    int cacheCapacity = Config::DEFAULT_CACHE_GRAPHS;
+    int numWorkers = 0;
+
+    for (int i = 2; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc)
+            socketPath = argv[++i];
+        else if (arg == "--cache" && i + 1 < argc)
+            cacheCapacity = std::atoi(argv[++i]);
+        else if (arg == "--workers" && i + 1 < argc)
+            numWorkers = std::atoi(argv[++i]);
+        else
+        {
+            printServeUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (cacheCapacity < 1)
+    {
+        std::cerr << "Erro: --cache deve ser >= 1" << std::endl;
+        return 1;
+    }
+
+    // A saída padrão pode ser o canal de respostas: as mensagens dos
+    // algoritmos e do leitor de grafos vão para std::cerr
+    std::streambuf *previous = std::cout.rdbuf(std::cerr.rdbuf());
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int status;
+    {
+        SolverDaemon daemon(static_cast<size_t>(cacheCapacity), numWorkers);
+        status = socketPath.empty() ? daemon.serveStream(STDIN_FILENO, STDOUT_FILENO)
+                                    : daemon.serveSocket(socketPath);
+    }
+
+    std::cout.rdbuf(previous);
+    return status;
+}
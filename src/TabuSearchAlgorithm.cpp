@@ -0,0 +1,267 @@
+#include "../include/TabuSearchAlgorithm.h"
+#include "../include/Config.h"
+#include <algorithm>
+#include <climits>
+
+TabuSearchAlgorithm::TabuSearchAlgorithm(const Graph &g, int p, int q, int maxIterationsPerSpan)
+    : graph(g),
+      p_param(p),
+      q_param(q),
+      maxIterationsPerSpan(std::max(1, maxIterationsPerSpan)),
+      lowerBound(0),
+      totalIterations(0),
+      incumbent(nullptr),
+      span(0),
+      totalConflicts(0)
+{
+}
+
+void TabuSearchAlgorithm::buildNeighborhoods()
+{
+    int n = graph.getNumVertices();
+    n1.assign(n, {});
+
+    std::vector<int> mark(n, -1);
+    for (int v = 0; v < n; ++v)
+    {
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u != v && mark[u] != v)
+            {
+                mark[u] = v;
+                n1[v].push_back(u);
+            }
+        }
+    }
+}
+
+// Soma sign às entradas de gamma dos vizinhos de v cujas cores conflitam com c
+void TabuSearchAlgorithm::placeColor(int v, int c, int sign)
+{
+    if (c <= 0)
+        return;
+
+    if (p_param > 0)
+    {
+        int lo = std::max(1, c - p_param + 1);
+        int hi = std::min(span, c + p_param - 1);
+        for (int u : n1[v])
+        {
+            for (int x = lo; x <= hi; ++x)
+                gammaAt(u, x) += sign;
+            updateConflictMembership(u);
+        }
+    }
+
+    if (q_param > 0)
+    {
+        int lo = std::max(1, c - q_param + 1);
+        int hi = std::min(span, c + q_param - 1);
+        for (int u : graph.getDistance2Neighbors(v))
+        {
+            for (int x = lo; x <= hi; ++x)
+                gammaAt(u, x) += sign;
+            updateConflictMembership(u);
+        }
+    }
+}
+
+void TabuSearchAlgorithm::updateConflictMembership(int v)
+{
+    bool inConflict = coloring[v] > 0 && gammaAt(v, coloring[v]) > 0;
+    if (inConflict && conflictPos[v] < 0)
+    {
+        conflictPos[v] = static_cast<int>(conflicting.size());
+        conflicting.push_back(v);
+    }
+    else if (!inConflict && conflictPos[v] >= 0)
+    {
+        int last = conflicting.back();
+        conflicting[conflictPos[v]] = last;
+        conflictPos[last] = conflictPos[v];
+        conflicting.pop_back();
+        conflictPos[v] = -1;
+    }
+}
+
+void TabuSearchAlgorithm::moveVertex(int v, int newColor)
+{
+    int oldColor = coloring[v];
+    totalConflicts += gammaAt(v, newColor) - (oldColor > 0 ? gammaAt(v, oldColor) : 0);
+
+    placeColor(v, oldColor, -1);
+    coloring[v] = newColor;
+    placeColor(v, newColor, +1);
+    updateConflictMembership(v);
+}
+
+// Prepara o estado para o span k: vértices com cor > k são descoloridos e
+// reinseridos gulosamente na cor de menor conflito
+void TabuSearchAlgorithm::resetSpan(int k)
+{
+    int n = graph.getNumVertices();
+    span = k;
+    gamma.assign(static_cast<size_t>(n) * (span + 1), 0);
+    tabuUntil.assign(gamma.size(), 0);
+    conflicting.clear();
+    conflictPos.assign(n, -1);
+    totalConflicts = 0;
+
+    std::vector<int> pending;
+    for (int v = 0; v < n; ++v)
+    {
+        if (coloring[v] <= 0 || coloring[v] > span)
+        {
+            coloring[v] = 0;
+            pending.push_back(v);
+        }
+    }
+
+    for (int v = 0; v < n; ++v)
+        placeColor(v, coloring[v], +1);
+
+    for (int v = 0; v < n; ++v)
+    {
+        if (coloring[v] > 0)
+            totalConflicts += gammaAt(v, coloring[v]);
+    }
+    totalConflicts /= 2;
+
+    for (int v : pending)
+    {
+        int bestColor = 1;
+        for (int c = 2; c <= span; ++c)
+        {
+            if (gammaAt(v, c) < gammaAt(v, bestColor))
+                bestColor = c;
+        }
+        moveVertex(v, bestColor);
+    }
+}
+
+// Laço tabu: termina com sucesso quando não há conflitos ou falha após
+// maxIterationsPerSpan iterações sem melhorar o menor número de conflitos
+bool TabuSearchAlgorithm::runTabu(long long &iterationCounter)
+{
+    long long bestConflicts = totalConflicts;
+    long long sinceImprovement = 0;
+
+    while (totalConflicts > 0 && sinceImprovement < maxIterationsPerSpan)
+    {
+        // Consulta o relógio só a cada 256 iterações
+        if (incumbent && (iterationCounter & 255) == 0 && incumbent->shouldStop())
+            break;
+        ++iterationCounter;
+        ++sinceImprovement;
+
+        int bestDelta = INT_MAX;
+        int chosenVertex = -1, chosenColor = -1;
+        int ties = 0;
+
+        for (int v : conflicting)
+        {
+            int current = coloring[v];
+            int base = gammaAt(v, current);
+            size_t row = static_cast<size_t>(v) * (span + 1);
+
+            for (int c = 1; c <= span; ++c)
+            {
+                if (c == current)
+                    continue;
+                int delta = gamma[row + c] - base;
+                bool isTabu = tabuUntil[row + c] > iterationCounter;
+                // Critério de aspiração: aceita movimento tabu que melhora a melhor solução
+                if (isTabu && totalConflicts + delta >= bestConflicts)
+                    continue;
+
+                if (delta < bestDelta)
+                {
+                    bestDelta = delta;
+                    chosenVertex = v;
+                    chosenColor = c;
+                    ties = 1;
+                }
+                else if (delta == bestDelta && rng.nextIndex(++ties) == 0)
+                {
+                    chosenVertex = v;
+                    chosenColor = c;
+                }
+            }
+        }
+
+        if (chosenVertex < 0)
+        {
+            // Todos os movimentos são tabu: movimento aleatório
+            chosenVertex = conflicting[rng.nextIndex(static_cast<int>(conflicting.size()))];
+            do
+            {
+                chosenColor = 1 + rng.nextIndex(span);
+            } while (span > 1 && chosenColor == coloring[chosenVertex]);
+        }
+
+        int oldColor = coloring[chosenVertex];
+        moveVertex(chosenVertex, chosenColor);
+
+        int tenure = rng.nextIndex(Config::TABU_TENURE_RANDOM) +
+                     static_cast<int>(Config::TABU_TENURE_FACTOR * conflicting.size());
+        tabuUntil[static_cast<size_t>(chosenVertex) * (span + 1) + oldColor] = iterationCounter + tenure;
+
+        if (totalConflicts < bestConflicts)
+        {
+            bestConflicts = totalConflicts;
+            sinceImprovement = 0;
+        }
+    }
+
+    return totalConflicts == 0;
+}
+
+std::vector<int> TabuSearchAlgorithm::solve(const std::vector<int> &initial)
+{
+    if (n1.empty())
+        buildNeighborhoods();
+
+    totalIterations = 0;
+    coloring = initial;
+
+    int startSpan = 0;
+    for (int c : coloring)
+        startSpan = std::max(startSpan, c);
+    if (startSpan <= 0)
+        return initial;
+
+    // Garante que o ponto de partida é viável (repara se necessário)
+    resetSpan(startSpan);
+    if (totalConflicts > 0 && !runTabu(totalIterations))
+        return initial;
+
+    std::vector<int> best = coloring;
+    int bestSpan = startSpan;
+    if (incumbent)
+        incumbent->publish(bestSpan);
+
+    while (bestSpan - 1 >= std::max(1, lowerBound))
+    {
+        // Spans acima do incumbente compartilhado não interessam mais
+        int nextSpan = bestSpan - 1;
+        if (incumbent)
+        {
+            if (incumbent->shouldStop())
+                break;
+            nextSpan = std::min(nextSpan, incumbent->getBestSpan() - 1);
+            if (nextSpan < std::max(1, lowerBound))
+                break;
+        }
+
+        resetSpan(nextSpan);
+        if (!runTabu(totalIterations))
+            break;
+
+        best = coloring;
+        bestSpan = *std::max_element(best.begin(), best.end());
+        if (incumbent)
+            incumbent->publish(bestSpan);
+    }
+
+    return best;
+}
@@ -0,0 +1,161 @@
+#include "../include/VertexOrdering.h"
+#include "../include/Config.h"
+#include "../include/BFSEngine.h"
+#include "../include/CompressedDistance2.h"
+#include "../include/Distance2Cache.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+bool VertexOrdering::isValid(const std::string &name)
+{
+    return name == Config::ORDER_DEGREE || name == Config::ORDER_SMALLEST_LAST ||
+           name == Config::ORDER_RANDOM || name == Config::ORDER_BFS;
+}
+
+std::vector<int> VertexOrdering::compute(const Graph &graph, const std::string &name, unsigned int seed,
+                                         int *degeneracy)
+{
+    if (degeneracy)
+        *degeneracy = -1;
+    if (name == Config::ORDER_SMALLEST_LAST)
+        return smallestLast(graph, degeneracy);
+    if (name == Config::ORDER_RANDOM)
+        return randomOrder(graph, seed);
+    if (name == Config::ORDER_BFS)
+        return breadthFirst(graph);
+    return byDegree(graph);
+}
+
+std::vector<int> VertexOrdering::byDegree(const Graph &graph)
+{
+    const int n = graph.getNumVertices();
+    std::vector<int> order(n);
+    for (int v = 0; v < n; ++v)
+        order[v] = v;
+    sortByDegree(graph, order);
+    return order;
+}
+
+std::vector<int> VertexOrdering::smallestLast(const Graph &graph, int *degeneracy)
+{
+    const int n = graph.getNumVertices();
+    const CompressedDistance2 *compressed = graph.getCompressedDistance2();
+    std::unique_ptr<Distance2Cache> cache;
+    if (!compressed && !graph.hasDistance2Index())
+        cache.reset(new Distance2Cache(graph, Distance2Cache::getDefaultBudget()));
+
+    // Vizinhos de v em G²: N1 e depois N2, da fonte disponível
+    auto forEachSquareNeighbor = [&](int v, auto f)
+    {
+        for (int u : graph.getNeighbors(v))
+            f(u);
+        if (compressed)
+            compressed->forEach(v, f);
+        else if (cache)
+        {
+            for (int u : cache->get(v))
+                f(u);
+        }
+        else
+        {
+            for (int u : graph.getDistance2Neighbors(v))
+                f(u);
+        }
+    };
+
+    std::vector<int> degree(n, 0);
+    int maxDegree = 0;
+    for (int v = 0; v < n; ++v)
+    {
+        forEachSquareNeighbor(v, [&](int u)
+                              { degree[v] += (u != v); });
+        maxDegree = std::max(maxDegree, degree[v]);
+    }
+
+    // Um balde por grau, como lista duplamente ligada (inserção na cabeça)
+    std::vector<int> head(maxDegree + 1, -1);
+    std::vector<int> next(n), prev(n);
+    auto link = [&](int v)
+    {
+        prev[v] = -1;
+        next[v] = head[degree[v]];
+        if (next[v] >= 0)
+            prev[next[v]] = v;
+        head[degree[v]] = v;
+    };
+    auto unlink = [&](int v)
+    {
+        if (prev[v] >= 0)
+            next[prev[v]] = next[v];
+        else
+            head[degree[v]] = next[v];
+        if (next[v] >= 0)
+            prev[next[v]] = prev[v];
+    };
+    for (int v = n - 1; v >= 0; --v)
+        link(v);
+
+    // O grau mínimo cai no máximo 1 por remoção, então o ponteiro anda O(n + |E(G²)|)
+    std::vector<uint8_t> removed(n, 0);
+    std::vector<int> order(n);
+    int minDegree = 0;
+    int k = 0;
+    for (int step = n - 1; step >= 0; --step)
+    {
+        while (head[minDegree] < 0)
+            ++minDegree;
+        const int v = head[minDegree];
+        unlink(v);
+        removed[v] = 1;
+        order[step] = v;
+        k = std::max(k, minDegree);
+
+        forEachSquareNeighbor(v, [&](int u)
+                              {
+            if (removed[u] || degree[u] == 0)
+                return;
+            unlink(u);
+            --degree[u];
+            link(u); });
+        minDegree = std::max(0, minDegree - 1);
+    }
+
+    if (degeneracy)
+        *degeneracy = k;
+    return order;
+}
+
+std::vector<int> VertexOrdering::randomOrder(const Graph &graph, unsigned int seed)
+{
+    const int n = graph.getNumVertices();
+    std::vector<int> order(n);
+    for (int v = 0; v < n; ++v)
+        order[v] = v;
+    std::mt19937 gen(seed);
+    for (int i = n - 1; i > 0; --i)
+        std::swap(order[i], order[std::uniform_int_distribution<int>(0, i)(gen)]);
+    return order;
+}
+
+std::vector<int> VertexOrdering::breadthFirst(const Graph &graph)
+{
+    const int n = graph.getNumVertices();
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<uint8_t> visited(n, 0);
+    BFSEngine bfs(graph);
+
+    // Cada componente parte do seu vértice de maior grau
+    for (int start : byDegree(graph))
+    {
+        if (visited[start])
+            continue;
+        for (int v : bfs.run({start}))
+        {
+            visited[v] = 1;
+            order.push_back(v);
+        }
+    }
+    return order;
+}
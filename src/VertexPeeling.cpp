@@ -0,0 +1,140 @@
+#include "../include/VertexPeeling.h"
+#include "../include/ConstructionEngine.h"
+#include <algorithm>
+#include <utility>
+
+VertexPeeling::VertexPeeling(const Graph &g, int p, int q)
+    : graph(g), p_param(p), q_param(q), localIndex(g.getNumVertices())
+{
+    int n = graph.getNumVertices();
+    kernelVertices.resize(n);
+    for (int v = 0; v < n; ++v)
+    {
+        kernelVertices[v] = v;
+        localIndex[v] = v;
+    }
+}
+
+int VertexPeeling::peel(int colors)
+{
+    int n = graph.getNumVertices();
+    const long long w1 = std::max(0, 2 * p_param - 1);
+    const long long w2 = std::max(0, 2 * q_param - 1);
+
+    // Cores proibidas no pior caso, contando só os vértices ainda presentes
+    std::vector<long long> forbidden(n, 0);
+    std::vector<char> removed(n, 0);
+    for (int v = 0; v < n; ++v)
+        removed[v] = localIndex[v] < 0;
+    for (int v = 0; v < n; ++v)
+    {
+        if (removed[v])
+            continue;
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u != v && !removed[u])
+                forbidden[v] += w1;
+        }
+        for (int u : graph.getDistance2Neighbors(v))
+        {
+            if (!removed[u])
+                forbidden[v] += w2;
+        }
+    }
+
+    std::vector<int> stack;
+    std::vector<char> queued(n, 0);
+    for (int v = 0; v < n; ++v)
+    {
+        if (!removed[v] && forbidden[v] < colors)
+        {
+            stack.push_back(v);
+            queued[v] = 1;
+        }
+    }
+
+    int count = 0;
+    while (!stack.empty())
+    {
+        int v = stack.back();
+        stack.pop_back();
+        removed[v] = 1;
+        peeled.push_back(v);
+        ++count;
+
+        auto release = [&](int u, long long weight)
+        {
+            if (removed[u])
+                return;
+            forbidden[u] -= weight;
+            if (!queued[u] && forbidden[u] < colors)
+            {
+                queued[u] = 1;
+                stack.push_back(u);
+            }
+        };
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u != v)
+                release(u, w1);
+        }
+        for (int u : graph.getDistance2Neighbors(v))
+            release(u, w2);
+    }
+
+    kernelVertices.clear();
+    for (int v = 0; v < n; ++v)
+    {
+        localIndex[v] = removed[v] ? -1 : static_cast<int>(kernelVertices.size());
+        if (!removed[v])
+            kernelVertices.push_back(v);
+    }
+    return count;
+}
+
+Graph VertexPeeling::buildKernel() const
+{
+    Graph kernel(getKernelSize(), false);
+    std::vector<std::vector<int>> lists(kernelVertices.size());
+
+    for (size_t i = 0; i < kernelVertices.size(); ++i)
+    {
+        int v = kernelVertices[i];
+        // Cada aresta aparece nas listas das duas pontas: insere só a partir da menor
+        for (int u : graph.getNeighbors(v))
+        {
+            if (u > v && localIndex[u] >= 0)
+                kernel.addEdge(static_cast<int>(i), localIndex[u]);
+        }
+        for (int u : graph.getDistance2Neighbors(v))
+        {
+            if (localIndex[u] >= 0)
+                lists[i].push_back(localIndex[u]);
+        }
+    }
+
+    kernel.setDistance2Index(std::move(lists));
+    return kernel;
+}
+
+std::vector<int> VertexPeeling::toKernel(const std::vector<int> &coloring) const
+{
+    std::vector<int> local(kernelVertices.size());
+    for (size_t i = 0; i < kernelVertices.size(); ++i)
+        local[i] = coloring[kernelVertices[i]];
+    return local;
+}
+
+std::vector<int> VertexPeeling::restore(const std::vector<int> &kernelColoring) const
+{
+    ConstructionState state(graph, p_param, q_param);
+    for (size_t i = 0; i < kernelVertices.size(); ++i)
+        state.assign(kernelVertices[i], kernelColoring[i]);
+
+    // Ao ser reinserido, cada vértice vê exatamente os vizinhos que estavam
+    // presentes quando foi removido: a contagem garante uma cor livre
+    for (auto it = peeled.rbegin(); it != peeled.rend(); ++it)
+        state.assign(*it, state.smallestValidColor(*it));
+
+    return state.coloring;
+}
@@ -0,0 +1,103 @@
+#include "../include/WarmStart.h"
+#include "../include/ConstructionEngine.h"
+#include "../include/VertexOrdering.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+bool WarmStart::readSolution(const std::string &filename, int numVertices, std::vector<int> &coloring)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo " << filename << std::endl;
+        return false;
+    }
+
+    coloring.assign(numVertices, 0);
+    int ignored = 0;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream iss(line);
+        int v, color;
+        if (!(iss >> v >> color) || v < 0 || v >= numVertices || color <= 0)
+        {
+            ++ignored;
+            continue;
+        }
+        coloring[v] = color;
+    }
+
+    if (ignored > 0)
+    {
+        std::cout << "[AVISO] " << ignored << " linhas inválidas ignoradas em " << filename << std::endl;
+    }
+    return true;
+}
+
+int WarmStart::repair(const Graph &graph, int p, int q, std::vector<int> &coloring)
+{
+    int n = graph.getNumVertices();
+    coloring.resize(n, 0);
+
+    ConstructionState state(graph, p, q);
+    std::vector<int> pending;
+
+    // Mantém cada cor compatível com os vértices já mantidos
+    for (int v = 0; v < n; ++v)
+    {
+        int c = coloring[v];
+        auto conflicts = [&state, c](int u, int separation) {
+            return state.colored[u] && std::abs(c - state.coloring[u]) < separation;
+        };
+
+        bool ok = c > 0;
+        for (int u : graph.getNeighbors(v))
+        {
+            if (!ok)
+                break;
+            if (u != v && conflicts(u, p))
+                ok = false;
+        }
+        if (ok && graph.hasDistance2Index())
+        {
+            for (int u : graph.getDistance2Neighbors(v))
+            {
+                if (conflicts(u, q))
+                {
+                    ok = false;
+                    break;
+                }
+            }
+        }
+        else if (ok)
+        {
+            for (int u : graph.getVerticesAtDistance2(v))
+            {
+                if (conflicts(u, q))
+                {
+                    ok = false;
+                    break;
+                }
+            }
+        }
+
+        if (ok)
+            state.assign(v, c);
+        else
+            pending.push_back(v);
+    }
+
+    VertexOrdering::sortByDegree(graph, pending);
+    for (int v : pending)
+        state.assign(v, state.smallestValidColor(v));
+
+    coloring = state.coloring;
+    return static_cast<int>(pending.size());
+}
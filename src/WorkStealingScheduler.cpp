@@ -0,0 +1,164 @@
+#include "../include/WorkStealingScheduler.h"
+#include <algorithm>
+
+WorkStealingScheduler::WorkStealingScheduler(int numWorkers)
+    : queued(0), unfinished(0), stopping(false), nextDeque(0),
+      statsStart(std::chrono::steady_clock::now())
+{
+    numWorkers = std::max(1, numWorkers);
+    for (int w = 0; w < numWorkers; ++w)
+        workers.emplace_back(new Worker());
+    for (int w = 0; w < numWorkers; ++w)
+        workers[w]->thread = std::thread(&WorkStealingScheduler::run, this, w);
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(idleMutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (auto &worker : workers)
+        worker->thread.join();
+}
+
+void WorkStealingScheduler::push(int worker, Task task)
+{
+    {
+        // Contadores e deque atualizados juntos: um worker acordado sempre encontra a tarefa
+        std::lock_guard<std::mutex> lock(idleMutex);
+        ++queued;
+        ++unfinished;
+        std::lock_guard<std::mutex> dequeLock(workers[worker]->mutex);
+        workers[worker]->tasks.push_back(std::move(task));
+    }
+    workAvailable.notify_one();
+}
+
+void WorkStealingScheduler::submit(Task task)
+{
+    push(static_cast<int>(nextDeque.fetch_add(1) % workers.size()), std::move(task));
+}
+
+void WorkStealingScheduler::submitTo(int worker, Task task)
+{
+    push(worker, std::move(task));
+}
+
+void WorkStealingScheduler::wait()
+{
+    std::unique_lock<std::mutex> lock(idleMutex);
+    allDone.wait(lock, [this]
+                 { return unfinished == 0; });
+}
+
+bool WorkStealingScheduler::popOwn(int self, Task &task)
+{
+    Worker &own = *workers[self];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (own.tasks.empty())
+        return false;
+    task = std::move(own.tasks.back());
+    own.tasks.pop_back();
+    return true;
+}
+
+// Rouba a metade mais antiga (arredondada para cima) da primeira deque não
+// vazia; a primeira tarefa roubada é executada e o resto vai para a própria deque
+bool WorkStealingScheduler::steal(int self, Task &task)
+{
+    const int n = static_cast<int>(workers.size());
+    for (int k = 1; k < n; ++k)
+    {
+        Worker &victim = *workers[(self + k) % n];
+        std::vector<Task> loot;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            size_t take = (victim.tasks.size() + 1) / 2;
+            for (size_t i = 0; i < take; ++i)
+            {
+                loot.push_back(std::move(victim.tasks.front()));
+                victim.tasks.pop_front();
+            }
+        }
+        if (loot.empty())
+            continue;
+
+        Worker &own = *workers[self];
+        ++own.stats.steals;
+        own.stats.stolenTasks += static_cast<long long>(loot.size());
+        task = std::move(loot.front());
+        if (loot.size() > 1)
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            for (size_t i = 1; i < loot.size(); ++i)
+                own.tasks.push_back(std::move(loot[i]));
+        }
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingScheduler::run(int self)
+{
+    Worker &own = *workers[self];
+    while (true)
+    {
+        Task task;
+        if (popOwn(self, task) || steal(self, task))
+        {
+            {
+                std::lock_guard<std::mutex> lock(idleMutex);
+                --queued;
+            }
+            auto start = std::chrono::steady_clock::now();
+            task(self);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            own.stats.busySeconds += elapsed.count();
+            ++own.stats.tasks;
+
+            std::lock_guard<std::mutex> lock(idleMutex);
+            if (--unfinished == 0)
+                allDone.notify_all();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(idleMutex);
+        workAvailable.wait(lock, [this]
+                           { return queued > 0 || stopping; });
+        if (stopping && queued == 0)
+            return;
+    }
+}
+
+std::vector<WorkStealingScheduler::WorkerStats> WorkStealingScheduler::getStats() const
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - statsStart;
+    std::vector<WorkerStats> stats;
+    for (const auto &worker : workers)
+    {
+        WorkerStats st = worker->stats;
+        st.utilization = elapsed.count() > 0 ? st.busySeconds / elapsed.count() : 0.0;
+        stats.push_back(st);
+    }
+    return stats;
+}
+
+void WorkStealingScheduler::resetStats()
+{
+    for (auto &worker : workers)
+        worker->stats = WorkerStats();
+    statsStart = std::chrono::steady_clock::now();
+}
+
+void WorkStealingScheduler::printStats(const std::vector<WorkerStats> &stats, std::ostream &out, const char *indent)
+{
+    for (size_t w = 0; w < stats.size(); ++w)
+    {
+        const WorkerStats &st = stats[w];
+        out << indent << "Worker " << w << ": " << st.tasks << " tarefas, " << st.steals << " roubos ("
+            << st.stolenTasks << " tarefas roubadas), ocupação " << st.utilization * 100.0 << "%" << std::endl;
+    }
+}
@@ -2,14 +2,30 @@
 #include "InputReader.h"
 #include "OutputWriter.h"
 #include "ResultLogger.h"
-#include "GreedyAlgorithm.h"
-#include "GRASPAlgorithm.h"
-#include "ReactiveGRASPAlgorithm.h"
+#include "Solver.h"
+#include "ComponentDecomposition.h"
+#include "VertexPeeling.h"
+#include "Portfolio.h"
+#include "LowerBound.h"
+#include "AllocationCounter.h"
+#include "ColorKernel.h"
+#include "BFSEngine.h"
+#include "GraphGenerator.h"
+#include "SolverDaemon.h"
+#include "BatchPipeline.h"
+#include "WarmStart.h"
+#include "DynamicColoring.h"
+#include "CompactGraph.h"
+#include "Distance2Cache.h"
+#include "CompressedDistance2.h"
+#include "VertexOrdering.h"
 #include "Config.h"
 #include <iostream>
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <cstdlib>
+#include <thread>
 #include <unistd.h>
 
 /**
@@ -40,23 +56,6 @@ unsigned int initializeRandomSeed(unsigned int customSeed = 0)
     return seed;
 }
 
-/**
- * Esta é apenas uma coloração trivial para testar o sistema de I/O
- */
-std::vector<int> exampleColoring(const Graph &graph, int p, int q)
-{
-    int n = graph.getNumVertices();
-    std::vector<int> coloring(n);
-
-    int spacing = std::max(p, q);
-    for (int i = 0; i < n; i++)
-    {
-        coloring[i] = i * spacing;
-    }
-
-    return coloring;
-}
-
 void printUsage(const char *programName)
 {
     std::cout << "\nUso: " << programName << " [opções]" << std::endl;
@@ -67,11 +66,38 @@ void printUsage(const char *programName)
     std::cout << "  -p <valor>       Parâmetro p do L(p,q)-coloring (padrão: 2)" << std::endl;
     std::cout << "  -q <valor>       Parâmetro q do L(p,q)-coloring (padrão: 1)" << std::endl;
     std::cout << "  -s <semente>     Semente de randomização (0 = automática)" << std::endl;
-    std::cout << "  -a <algoritmo>   Algoritmo: greedy|grasp|reactive (padrão: greedy)" << std::endl;
+    std::cout << "  -a <algoritmo>   Algoritmo: greedy|dsatur|grasp|reactive|tabu|exact|portfolio (padrão: greedy)" << std::endl;
     std::cout << "  --alpha <valor>  Valor de alpha para GRASP (0.0-1.0)" << std::endl;
     std::cout << "  --iter <n>       Número de iterações para GRASP" << std::endl;
     std::cout << "  --block <n>      Tamanho do bloco para GRASP reativo" << std::endl;
+    std::cout << "  --elite <n>      Conjunto elite + religamento de caminhos no GRASP (0 = desativado)" << std::endl;
+    std::cout << "  --rcl-sample <v> RCL amostrada: v >= 1 vértices por passo ou fração de n (0 = desativada)" << std::endl;
+    std::cout << "  --threads <n>    Threads para o GRASP e o GRASP reativo (0 = todos os núcleos)" << std::endl;
+    std::cout << "  --init <arquivo> Solução inicial (formato de -o); vértices ausentes/inválidos são reparados" << std::endl;
+    std::cout << "  --changes <arq>  Aplica alterações do grafo em lotes e repara a solução localmente" << std::endl;
+    std::cout << "  --checkpoint <f> Grava checkpoints periódicos do GRASP reativo em f" << std::endl;
+    std::cout << "  --checkpoint-every <s> Intervalo mínimo entre checkpoints em segundos (padrão: 60)" << std::endl;
+    std::cout << "  --resume         Continua o GRASP reativo a partir do arquivo de --checkpoint" << std::endl;
+    std::cout << "  --tabu-init <a>  Solução inicial da busca tabu: greedy|grasp (padrão: greedy)" << std::endl;
+    std::cout << "  --order <o>      Ordem do guloso: degree|sl|random|bfs (padrão: degree); com grasp,"
+              << " reactive e exact, o guloso nessa ordem é a solução inicial" << std::endl;
+    std::cout << "  --kernel <k>     Kernel de cores: auto|avx2|sse2|scalar (padrão: auto)" << std::endl;
+    std::cout << "  --width <w>      Guloso com ids/cores compactos: auto|16|32|int (padrão: int)" << std::endl;
+    std::cout << "  --width-report   Compara memória e vazão do guloso em cada largura" << std::endl;
+    std::cout << "  --n2-cache <MB>  Sem índice de distância 2: N2 sob demanda em cache de MB megabytes" << std::endl;
+    std::cout << "  --n2-compressed  Índice de distância 2 em delta + varint (relata memória e vazão)" << std::endl;
+    std::cout << "  --portfolio <l>  Configurações do portfólio, ex.: greedy,grasp:0.1,reactive,tabu" << std::endl;
+    std::cout << "  --time-limit <s> Tempo máximo do portfólio ou do exact em segundos (0 = sem limite)" << std::endl;
+    std::cout << "  --node-limit <n> Máximo de nós do branch-and-bound exato (0 = sem limite, padrão: "
+              << Config::DEFAULT_EXACT_NODE_LIMIT << ")" << std::endl;
+    std::cout << "  --peel           Remove vértices sempre coloríveis, resolve o núcleo e os reinsere" << std::endl;
+    std::cout << "  --components     Resolve cada componente conexa separadamente, em paralelo (--threads)" << std::endl;
+    std::cout << "  --stats          Exibe diâmetro, raio e excentricidade média do grafo" << std::endl;
     std::cout << "  -h, --help       Mostra esta mensagem" << std::endl;
+    std::cout << "\nSubcomandos:" << std::endl;
+    std::cout << "  generate <tipo>  Gera instância sintética (" << programName << " generate para detalhes)" << std::endl;
+    std::cout << "  serve            Servidor JSON com cache de grafos (" << programName << " serve --help para detalhes)" << std::endl;
+    std::cout << "  batch <lista>    Resolve várias instâncias em pipeline (" << programName << " batch para detalhes)" << std::endl;
     std::cout << "\nExemplo:" << std::endl;
     std::cout << "  " << programName << " -i instances/grafo1.txt -p 2 -q 1 -o output/solucao.txt" << std::endl;
     std::cout << std::endl;
@@ -79,6 +105,19 @@ void printUsage(const char *programName)
 
 int main(int argc, char *argv[])
 {
+    if (argc > 1 && std::string(argv[1]) == "generate")
+    {
+        return GraphGenerator::runCommand(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "serve")
+    {
+        return SolverDaemon::runCommand(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "batch")
+    {
+        return BatchPipeline::runCommand(argc, argv);
+    }
+
     std::cout << "========================================" << std::endl;
     std::cout << "   L(p,q)-Coloring Solver" << std::endl;
     std::cout << "========================================\n"
@@ -96,6 +135,27 @@ int main(int argc, char *argv[])
     int blockSize = Config::DEFAULT_BLOCK_SIZE_GRASPR;
     bool iterationsSet = false;
     bool blockSizeSet = false;
+    std::string tabuInit = Config::ALGORITHM_GREEDY;
+    std::string order;
+    int numThreads = Config::DEFAULT_THREADS;
+    int eliteSize = Config::DEFAULT_ELITE_SIZE;
+    bool showStats = false;
+    int compactWidth = -1;
+    bool widthReport = false;
+    double n2CacheMegabytes = -1.0;
+    bool n2Compressed = false;
+    double rclSample = Config::DEFAULT_RCL_SAMPLE;
+    std::string checkpointFile = "";
+    double checkpointInterval = Config::DEFAULT_CHECKPOINT_INTERVAL;
+    bool resume = false;
+    std::string initFile = "";
+    std::string changesFile = "";
+    bool decompose = false;
+    bool peel = false;
+    bool threadsSet = false;
+    std::string portfolioSpec = Config::DEFAULT_PORTFOLIO;
+    double timeLimit = Config::DEFAULT_TIME_LIMIT;
+    long long nodeLimit = Config::DEFAULT_EXACT_NODE_LIMIT;
 
     // Parse de argumentos da linha de comando
     for (int i = 1; i < argc; i++)
@@ -149,6 +209,111 @@ int main(int argc, char *argv[])
             blockSize = std::atoi(argv[++i]);
             blockSizeSet = true;
         }
+        else if (arg == "--elite" && i + 1 < argc)
+        {
+            eliteSize = std::atoi(argv[++i]);
+        }
+        else if (arg == "--rcl-sample" && i + 1 < argc)
+        {
+            rclSample = std::atof(argv[++i]);
+        }
+        else if (arg == "--init" && i + 1 < argc)
+        {
+            initFile = argv[++i];
+        }
+        else if (arg == "--changes" && i + 1 < argc)
+        {
+            changesFile = argv[++i];
+        }
+        else if (arg == "--checkpoint" && i + 1 < argc)
+        {
+            checkpointFile = argv[++i];
+        }
+        else if (arg == "--checkpoint-every" && i + 1 < argc)
+        {
+            checkpointInterval = std::atof(argv[++i]);
+        }
+        else if (arg == "--resume")
+        {
+            resume = true;
+        }
+        else if (arg == "--threads" && i + 1 < argc)
+        {
+            numThreads = std::atoi(argv[++i]);
+            threadsSet = true;
+        }
+        else if (arg == "--kernel" && i + 1 < argc)
+        {
+            ColorKernel::Isa isa;
+            if (!ColorKernel::parse(argv[++i], isa))
+            {
+                std::cerr << "Erro: kernel desconhecido: " << argv[i] << std::endl;
+                return 1;
+            }
+            ColorKernel::select(isa);
+        }
+        else if (arg == "--width" && i + 1 < argc)
+        {
+            if (!CompactGraph::parseWidth(argv[++i], compactWidth))
+            {
+                std::cerr << "Erro: largura desconhecida: " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--width-report")
+        {
+            widthReport = true;
+        }
+        else if (arg == "--n2-compressed")
+        {
+            n2Compressed = true;
+        }
+        else if (arg == "--n2-cache" && i + 1 < argc)
+        {
+            n2CacheMegabytes = std::atof(argv[++i]);
+            if (n2CacheMegabytes < 0)
+            {
+                std::cerr << "Erro: --n2-cache deve ser >= 0" << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--portfolio" && i + 1 < argc)
+        {
+            portfolioSpec = argv[++i];
+        }
+        else if (arg == "--time-limit" && i + 1 < argc)
+        {
+            timeLimit = std::atof(argv[++i]);
+        }
+        else if (arg == "--node-limit" && i + 1 < argc)
+        {
+            nodeLimit = std::atoll(argv[++i]);
+        }
+        else if (arg == "--peel")
+        {
+            peel = true;
+        }
+        else if (arg == "--components")
+        {
+            decompose = true;
+        }
+        else if (arg == "--stats")
+        {
+            showStats = true;
+        }
+        else if (arg == "--tabu-init" && i + 1 < argc)
+        {
+            tabuInit = argv[++i];
+        }
+        else if (arg == "--order" && i + 1 < argc)
+        {
+            order = argv[++i];
+            if (!VertexOrdering::isValid(order))
+            {
+                std::cerr << "Erro: --order deve ser degree, sl, random ou bfs" << std::endl;
+                return 1;
+            }
+        }
     }
 
     if (algorithm == Config::ALGORITHM_REACTIVE)
@@ -162,6 +327,62 @@ int main(int argc, char *argv[])
             blockSize = Config::DEFAULT_BLOCK_SIZE_GRASPR;
         }
     }
+    else if (algorithm == Config::ALGORITHM_TABU)
+    {
+        if (!iterationsSet)
+        {
+            iterations = Config::DEFAULT_TABU_ITERATIONS;
+        }
+    }
+
+    // O portfólio usa por padrão todos os núcleos
+    if (algorithm == Config::ALGORITHM_PORTFOLIO && !threadsSet)
+    {
+        numThreads = 0;
+    }
+
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if (resume && checkpointFile.empty())
+    {
+        std::cerr << "Erro: --resume requer --checkpoint <arquivo>" << std::endl;
+        return 1;
+    }
+
+    if (decompose && algorithm == Config::ALGORITHM_PORTFOLIO)
+    {
+        std::cerr << "Erro: -a portfolio não é suportado com --components" << std::endl;
+        return 1;
+    }
+
+    if (decompose && !checkpointFile.empty())
+    {
+        std::cerr << "Erro: --checkpoint não é suportado com --components" << std::endl;
+        return 1;
+    }
+
+    // Sem as listas do índice, só os motores de construção (guloso, DSATUR e
+    // GRASP sem religamento) e a validação sabem obter N2 sob demanda ou comprimido
+    const bool lazyDistance2 = n2CacheMegabytes >= 0;
+    if (lazyDistance2 && n2Compressed)
+    {
+        std::cerr << "Erro: use --n2-cache ou --n2-compressed, não os dois" << std::endl;
+        return 1;
+    }
+    if ((lazyDistance2 || n2Compressed) &&
+        ((algorithm != Config::ALGORITHM_GREEDY && algorithm != Config::ALGORITHM_DSATUR &&
+          algorithm != Config::ALGORITHM_GRASP && algorithm != Config::ALGORITHM_REACTIVE) ||
+         eliteSize > 0 || compactWidth >= 0 || widthReport || peel || decompose ||
+         !initFile.empty() || !changesFile.empty()))
+    {
+        std::cerr << "Erro: " << (lazyDistance2 ? "--n2-cache" : "--n2-compressed")
+                  << " suporta apenas -a greedy|dsatur|grasp|reactive, sem --elite, --width, "
+                  << "--width-report, --peel, --components, --init ou --changes" << std::endl;
+        return 1;
+    }
 
     if (inputFile.empty())
     {
@@ -181,57 +402,270 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    if (lazyDistance2)
+    {
+        Distance2Cache::setDefaultBudget(static_cast<size_t>(n2CacheMegabytes * 1024.0 * 1024.0));
+        std::cout << "Índice de distância 2 sob demanda (cache de " << n2CacheMegabytes
+                  << " MB por thread)" << std::endl;
+    }
+    else
+    {
+        auto indexStart = std::chrono::high_resolution_clock::now();
+        graph.buildDistance2Index();
+        std::chrono::duration<double> indexTime = std::chrono::high_resolution_clock::now() - indexStart;
+        std::cout << "Índice de distância 2 construído em " << indexTime.count() << " segundos" << std::endl;
+    }
+
+    if (n2Compressed)
+    {
+        auto compressStart = std::chrono::high_resolution_clock::now();
+        auto compressed = std::make_shared<const CompressedDistance2>(graph);
+        std::chrono::duration<double> compressTime = std::chrono::high_resolution_clock::now() - compressStart;
+        std::cout << "Índice comprimido em " << compressTime.count() << " segundos" << std::endl;
+        CompressedDistance2::report(graph, *compressed, std::cout);
+        graph.setCompressedDistance2Index(compressed);
+    }
+
+    if (showStats)
+    {
+        auto statsStart = std::chrono::high_resolution_clock::now();
+        BFSEngine bfs(graph);
+        BFSEngine::DistanceStats stats = bfs.distanceStats();
+        std::chrono::duration<double> statsTime = std::chrono::high_resolution_clock::now() - statsStart;
+        std::cout << "Estatísticas de distância (" << statsTime.count() << " segundos):" << std::endl;
+        std::cout << "  Componentes conexas: " << stats.components << std::endl;
+        std::cout << "  Diâmetro: " << stats.diameter << std::endl;
+        std::cout << "  Raio: " << stats.radius << std::endl;
+        std::cout << "  Excentricidade média: " << stats.averageEccentricity << std::endl;
+    }
+
+    if (widthReport)
+    {
+        CompactGraph::report(graph, p, q, std::cout);
+    }
+
     std::cout << "\nParâmetros do problema:" << std::endl;
     std::cout << "  p = " << p << " (diferença mínima para vértices adjacentes)" << std::endl;
     std::cout << "  q = " << q << " (diferença mínima para vértices a distância 2)" << std::endl;
     std::cout << "  Algoritmo: " << algorithm << std::endl;
+    std::cout << "  Kernel de cores: " << ColorKernel::name(ColorKernel::active()) << std::endl;
+
+    int lowerBound = LowerBound::compute(graph, p, q);
+    std::cout << "  Limite inferior da maior cor: " << lowerBound << std::endl;
+
+    // Partida a quente: solução lida de arquivo e reparada
+    std::vector<int> initialColoring;
+    int initialMaxColor = 0;
+    if (!initFile.empty())
+    {
+        if (!WarmStart::readSolution(initFile, graph.getNumVertices(), initialColoring))
+        {
+            return 1;
+        }
+        int repaired = WarmStart::repair(graph, p, q, initialColoring);
+        initialMaxColor = *std::max_element(initialColoring.begin(), initialColoring.end());
+        std::cout << "  Solução inicial: " << initFile << " (maior cor " << initialMaxColor
+                  << ", " << repaired << " vértices reparados)" << std::endl;
+    }
 
     auto startTime = std::chrono::high_resolution_clock::now();
+    unsigned long long allocationsBefore = AllocationCounter::count();
 
-    std::vector<int> coloring;
-    double bestAlphaUsed = -1.0;
-    double averageSolution = -1.0;
+    // --rcl-sample: valores >= 1 são tamanhos absolutos; em (0, 1), frações de n
+    SolverOptions options;
+    options.algorithm = algorithm;
+    options.p = p;
+    options.q = q;
+    options.alpha = alpha;
+    options.iterations = iterations;
+    options.blockSize = blockSize;
+    options.eliteSize = eliteSize;
+    options.numThreads = numThreads;
+    options.rclSampleCount = rclSample >= 1.0 ? static_cast<int>(rclSample) : 0;
+    options.rclSampleFraction = rclSample >= 1.0 ? 0.0 : rclSample;
+    options.tabuInit = tabuInit;
+    options.order = order;
+    options.compactWidth = compactWidth;
+    options.lowerBound = lowerBound;
+    options.nodeLimit = nodeLimit;
+    options.timeLimit = timeLimit;
+    options.initialColoring = initialColoring;
+    options.initialLabel = initFile;
+    options.checkpointFile = checkpointFile;
+    options.checkpointInterval = checkpointInterval;
+    options.checkpointSeed = seed;
+    options.resume = resume;
 
-    if (algorithm == Config::ALGORITHM_GREEDY)
+    // Redução: os vértices sempre coloríveis são removidos e o núcleo é resolvido
+    const Graph *target = &graph;
+    Graph kernel;
+    VertexPeeling peeling(graph, p, q);
+    if (peel)
     {
-        std::cout << "[INFO] Executando algoritmo guloso (greedy)..." << std::endl;
-        GreedyAlgorithm greedy(graph, p, q);
-        coloring = greedy.solve();
+        auto peelStart = std::chrono::high_resolution_clock::now();
+        int removed = peeling.peel(lowerBound);
+        kernel = peeling.buildKernel();
+        target = &kernel;
+        if (!initialColoring.empty())
+        {
+            options.initialColoring = peeling.toKernel(initialColoring);
+        }
+        std::chrono::duration<double> peelTime = std::chrono::high_resolution_clock::now() - peelStart;
+        std::cout << "[INFO] Redução: núcleo com " << peeling.getKernelSize() << " de "
+                  << graph.getNumVertices() << " vértices (" << removed << " removidos, "
+                  << 100.0 * removed / std::max(1, graph.getNumVertices()) << "%) em "
+                  << peelTime.count() << " segundos" << std::endl;
     }
-    else if (algorithm == Config::ALGORITHM_GRASP)
+
+    // Configuração efetiva (no portfólio, a da vencedora), para o registro
+    std::string runAlgorithm = algorithm;
+    double runAlpha = alpha;
+    int runIterations = iterations;
+    int runBlockSize = blockSize;
+
+    SolverResult result;
+    if (target->getNumVertices() == 0)
     {
-        std::cout << "[INFO] Executando GRASP (alpha=" << alpha << ", iter=" << iterations << ")..." << std::endl;
-        GRASPAlgorithm grasp(graph, p, q, alpha, iterations);
-        coloring = grasp.solve();
-        averageSolution = grasp.getAverageSolution();
+        std::cout << "[INFO] Núcleo vazio: todos os vértices são reinseridos gulosamente" << std::endl;
     }
-    else if (algorithm == Config::ALGORITHM_REACTIVE)
+    else if (algorithm == Config::ALGORITHM_PORTFOLIO)
     {
-        std::cout << "[INFO] Executando GRASP reativo (alphas=";
-        for (size_t i = 0; i < Config::DEFAULT_REACTIVE_ALPHAS.size(); ++i)
+        std::vector<Portfolio::Entry> entries;
+        if (!Portfolio::parse(portfolioSpec, options, iterationsSet ? iterations : 0,
+                              blockSizeSet ? blockSize : 0, entries))
+        {
+            return 1;
+        }
+        std::cout << "[INFO] Portfólio: " << portfolioSpec << " (threads=" << numThreads;
+        if (timeLimit > 0)
         {
-            std::cout << Config::DEFAULT_REACTIVE_ALPHAS[i];
-            if (i + 1 < Config::DEFAULT_REACTIVE_ALPHAS.size())
-                std::cout << ",";
+            std::cout << ", tempo máximo=" << timeLimit << "s";
         }
-        std::cout << ", bloco=" << blockSize << ", iter=" << iterations << ")..." << std::endl;
+        std::cout << ")..." << std::endl;
 
-        ReactiveGRASPAlgorithm reactive(graph, p, q,
-                                        Config::DEFAULT_REACTIVE_ALPHAS,
-                                        blockSize,
-                                        iterations);
-        coloring = reactive.solve();
-        bestAlphaUsed = reactive.getBestAlphaUsed();
-        averageSolution = reactive.getAverageSolution();
+        Portfolio portfolio(*target, std::move(entries));
+        result = portfolio.run(numThreads, lowerBound, timeLimit);
+        for (size_t k = 0; k < portfolio.getEntries().size(); ++k)
+        {
+            const Portfolio::EntryStats &st = portfolio.getStats()[k];
+            std::cout << "  " << portfolio.getEntries()[k].label << ": ";
+            if (!st.started)
+            {
+                std::cout << "cancelado antes de iniciar";
+            }
+            else if (st.maxColor > 0)
+            {
+                std::cout << "maior cor " << st.maxColor << ", " << st.seconds << " segundos";
+            }
+            else
+            {
+                std::cout << "nenhuma construção abaixo do incumbente, " << st.seconds << " segundos";
+            }
+            std::cout << (static_cast<int>(k) == portfolio.getWinner() ? "  <- vencedor" : "") << std::endl;
+        }
+        if (portfolio.wasTimedOut())
+        {
+            std::cout << "[INFO] Tempo máximo esgotado" << std::endl;
+        }
+        if (portfolio.getWinner() >= 0)
+        {
+            const SolverOptions &won = portfolio.getEntries()[portfolio.getWinner()].options;
+            runAlgorithm = won.algorithm;
+            runAlpha = won.alpha;
+            runIterations = won.iterations;
+            runBlockSize = won.blockSize;
+            std::cout << "[INFO] Vencedor: " << portfolio.getEntries()[portfolio.getWinner()].label << std::endl;
+        }
+    }
+    else if (decompose)
+    {
+        // Cada componente conexa é resolvida à parte, em paralelo
+        ComponentDecomposition decomposition(*target);
+        std::cout << "[INFO] Componentes conexas: " << decomposition.getNumComponents()
+                  << " (maior: " << decomposition.getLargestSize() << " vértices, isolados: "
+                  << decomposition.getNumIsolated() << ")" << std::endl;
+        std::cout << "[INFO] Resolvendo componentes com " << algorithm << " (iter=" << iterations
+                  << " por componente, threads=" << numThreads << ")..." << std::endl;
+
+        std::vector<ComponentDecomposition::ComponentStats> componentStats;
+        std::vector<WorkStealingScheduler::WorkerStats> workerStats;
+        result = decomposition.solve(options, numThreads, &componentStats, &workerStats);
+        int shown = std::min<int>(componentStats.size(), 5);
+        for (int k = 0; k < shown; ++k)
+        {
+            const ComponentDecomposition::ComponentStats &st = componentStats[k];
+            std::cout << "  Componente " << st.component << ": " << st.size << " vértices, maior cor "
+                      << st.maxColor << ", " << st.seconds << " segundos" << std::endl;
+        }
+        if (static_cast<int>(componentStats.size()) > shown)
+        {
+            std::cout << "  ... mais " << componentStats.size() - shown << " componentes" << std::endl;
+        }
+        if (workerStats.size() > 1)
+        {
+            std::cout << "[INFO] Escalonador (roubo de trabalho):" << std::endl;
+            WorkStealingScheduler::printStats(workerStats, std::cout, "  ");
+        }
     }
     else
     {
-        std::cout << "[AVISO] Algoritmo solicitado não implementado; usando coloração de exemplo." << std::endl;
-        coloring = exampleColoring(graph, p, q);
+        result = Solver::run(*target, options);
+    }
+    if (!result.ok)
+    {
+        return 1;
+    }
+
+    if (peel)
+    {
+        auto restoreStart = std::chrono::high_resolution_clock::now();
+        int kernelMaxColor = 0;
+        for (int c : result.coloring)
+            kernelMaxColor = std::max(kernelMaxColor, c);
+        result.coloring = peeling.restore(result.coloring);
+        std::chrono::duration<double> restoreTime = std::chrono::high_resolution_clock::now() - restoreStart;
+        std::cout << "[INFO] Maior cor no núcleo: " << kernelMaxColor << "; " << peeling.getNumPeeled()
+                  << " vértices reinseridos em " << restoreTime.count() << " segundos" << std::endl;
     }
 
+    std::vector<int> coloring = std::move(result.coloring);
+    double bestAlphaUsed = result.bestAlphaUsed;
+    double averageSolution = result.averageSolution;
+    int rclSampleSize = result.rclSampleSize;
+
     auto endTime = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> elapsed = endTime - startTime;
+    unsigned long long solveAllocations = AllocationCounter::count() - allocationsBefore;
+
+    // Alterações dinâmicas: cada lote é aplicado e reparado localmente
+    if (!changesFile.empty())
+    {
+        std::cout << "\nAplicando alterações de: " << changesFile << std::endl;
+        DynamicColoring dynamic(graph, p, q, coloring);
+        std::vector<DynamicColoring::BatchStats> batches;
+        if (!dynamic.applyChangeLog(changesFile, batches))
+        {
+            return 1;
+        }
+        for (size_t b = 0; b < batches.size(); ++b)
+        {
+            const DynamicColoring::BatchStats &st = batches[b];
+            std::cout << "  Lote " << (b + 1) << ": " << st.changes << " alterações, "
+                      << st.checked << " vértices verificados, " << st.recolored << " recoloridos, "
+                      << "maior cor " << st.maxColor << ", atualização " << st.applySeconds * 1000.0
+                      << " ms, reparo " << st.repairSeconds * 1000.0 << " ms" << std::endl;
+        }
+        coloring = dynamic.getColoring();
+
+        // O limite inferior e o gap passam a se referir ao grafo alterado
+        lowerBound = LowerBound::compute(graph, p, q);
+        std::cout << "  Limite inferior do grafo alterado: " << lowerBound << std::endl;
+    }
+    else if (result.provenBound > lowerBound)
+    {
+        // O branch-and-bound provou um limite melhor (ou o ótimo)
+        lowerBound = result.provenBound;
+    }
 
     int maxColor = 0;
     for (int color : coloring)
@@ -239,8 +673,20 @@ int main(int argc, char *argv[])
         maxColor = std::max(maxColor, color);
     }
 
+    if (lazyDistance2)
+    {
+        std::cout << "Cache de distância 2:" << std::endl;
+        Distance2Cache::printMetrics(Distance2Cache::totals(), std::cout, "  ");
+    }
+
     std::cout << "Tempo de execução: " << elapsed.count() << " segundos" << std::endl;
+    if (AllocationCounter::enabled())
+    {
+        std::cout << "Alocações no heap durante a resolução: " << solveAllocations << std::endl;
+    }
     std::cout << "Maior cor utilizada: " << maxColor << std::endl;
+    std::cout << "Limite inferior: " << lowerBound
+              << " (gap: " << LowerBound::gap(maxColor, lowerBound) * 100.0 << "%)" << std::endl;
     if (averageSolution >= 0)
     {
         std::cout << "Média das soluções: " << averageSolution << std::endl;
@@ -277,22 +723,26 @@ int main(int argc, char *argv[])
     int logBlockSize = 0;
     double logBestAlpha = -1.0;
     double logAverageSolution = -1.0;
-    if (algorithm == Config::ALGORITHM_GRASP)
+    if (runAlgorithm == Config::ALGORITHM_GRASP)
     {
-        logAlpha = alpha;
-        logIterations = iterations;
+        logAlpha = runAlpha;
+        logIterations = runIterations;
         logAverageSolution = averageSolution;
     }
-    else if (algorithm == Config::ALGORITHM_REACTIVE)
+    else if (runAlgorithm == Config::ALGORITHM_TABU)
+    {
+        logIterations = runIterations;
+    }
+    else if (runAlgorithm == Config::ALGORITHM_REACTIVE)
     {
-        logIterations = iterations;
-        logBlockSize = blockSize;
+        logIterations = runIterations;
+        logBlockSize = runBlockSize;
         logAverageSolution = averageSolution;
         logBestAlpha = bestAlphaUsed;
     }
     logger.logResult(
         inputFile,
-        algorithm,
+        algorithm == Config::ALGORITHM_PORTFOLIO ? algorithm + "/" + runAlgorithm : algorithm,
         p, q,
         logAlpha,
         logIterations,
@@ -301,7 +751,9 @@ int main(int argc, char *argv[])
         elapsed.count(),
         maxColor,
         logBestAlpha,
-        logAverageSolution);
+        logAverageSolution,
+        lowerBound,
+        rclSampleSize);
 
     std::cout << "\n========================================" << std::endl;
     std::cout << "   Execução concluída com sucesso!" << std::endl;
@@ -0,0 +1,92 @@
+// Compara os kernels de cor (AVX2, SSE2 e escalar) entre si e com uma
+// referência ingênua em fatias aleatórias. Uso: kernel_check [casos] [semente]
+#include "../include/ColorKernel.h"
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Menor cor >= start a distância >= p das cores de n1 e >= q das de n2 (0 = sem cor)
+    int referenceClearing(const std::vector<int> &n1, int p, const std::vector<int> &n2, int q, int start)
+    {
+        for (int color = start;; ++color)
+        {
+            bool ok = true;
+            for (int c : n1)
+                ok = ok && (c == 0 || std::abs(color - c) >= p);
+            for (int c : n2)
+                ok = ok && (c == 0 || std::abs(color - c) >= q);
+            if (ok)
+                return color;
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const int cases = argc > 1 ? std::atoi(argv[1]) : 20000;
+    const unsigned int seed = argc > 2 ? static_cast<unsigned int>(std::atoi(argv[2])) : 12345u;
+
+    std::vector<ColorKernel::Isa> isas = {ColorKernel::Isa::Scalar};
+    if (static_cast<int>(ColorKernel::detect()) >= static_cast<int>(ColorKernel::Isa::SSE2))
+        isas.push_back(ColorKernel::Isa::SSE2);
+    if (ColorKernel::detect() == ColorKernel::Isa::AVX2)
+        isas.push_back(ColorKernel::Isa::AVX2);
+
+    std::mt19937 gen(seed);
+    auto uniform = [&gen](int lo, int hi)
+    { return std::uniform_int_distribution<int>(lo, hi)(gen); };
+
+    int failures = 0;
+    std::vector<int> n1, n2;
+    for (int k = 0; k < cases && failures < 10; ++k)
+    {
+        // Tamanhos que cobrem as caudas não múltiplas de 4 e 8; cores esparsas
+        // ou densas, com vértices sem cor (0)
+        const int maxColor = uniform(1, 200);
+        const int zeroPercent = uniform(0, 50);
+        auto fill = [&](std::vector<int> &slice)
+        {
+            slice.resize(uniform(0, 70));
+            for (int &c : slice)
+                c = uniform(1, 100) <= zeroPercent ? 0 : uniform(1, maxColor);
+        };
+        fill(n1);
+        fill(n2);
+        const int p = uniform(0, 5);
+        const int q = uniform(0, 5);
+        const int color = uniform(1, maxColor + 6);
+        const int start = uniform(1, 10);
+
+        const int jumpScalar = ColorKernel::violationJumpScalar(n1.data(), n1.size(), color, p);
+        const int clearingRef = referenceClearing(n1, p, n2, q, start);
+        for (ColorKernel::Isa isa : isas)
+        {
+            int jump = jumpScalar;
+            if (isa == ColorKernel::Isa::SSE2)
+                jump = ColorKernel::violationJumpSSE2(n1.data(), n1.size(), color, p);
+            else if (isa == ColorKernel::Isa::AVX2)
+                jump = ColorKernel::violationJumpAVX2(n1.data(), n1.size(), color, p);
+
+            ColorKernel::select(isa);
+            const int clearing = ColorKernel::smallestClearing(n1.data(), n1.size(), p, n2.data(), n2.size(), q, start);
+
+            if (jump != jumpScalar || clearing != clearingRef)
+            {
+                ++failures;
+                std::cerr << "Divergência (" << ColorKernel::name(isa) << ", caso " << k << "): violationJump "
+                          << jump << " vs escalar " << jumpScalar << ", smallestClearing " << clearing
+                          << " vs referência " << clearingRef << " (|N1|=" << n1.size() << ", |N2|=" << n2.size()
+                          << ", p=" << p << ", q=" << q << ", cor=" << color << ", início=" << start << ")" << std::endl;
+            }
+        }
+    }
+
+    std::cout << "Kernels de cor: " << cases << " casos aleatórios (semente " << seed << "), implementações:";
+    for (ColorKernel::Isa isa : isas)
+        std::cout << " " << ColorKernel::name(isa);
+    std::cout << (failures == 0 ? " — idênticas" : " — DIVERGENTES") << std::endl;
+    return failures == 0 ? 0 : 1;
+}